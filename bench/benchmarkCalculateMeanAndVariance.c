@@ -0,0 +1,90 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "benchmarkDatasets.h"
+
+/*
+ *	Benchmarks of `calculateMeanAndVarianceOfFloatSamples()` and
+ *	`calculateMeanAndVarianceOfDoubleSamples()` on arrays from a few samples, which
+ *	fit in the L1 cache, to larger than the last-level cache.
+ */
+
+typedef struct
+{
+	FloatingPointVariableType	type;
+	const void *			samples;
+	size_t				numberOfSamples;
+	MeanAndVariance			result;
+} MeanAndVarianceBenchmark;
+
+static void
+meanAndVarianceBenchmark(void *  context)
+{
+	MeanAndVarianceBenchmark *	benchmark = (MeanAndVarianceBenchmark *)context;
+
+	if (benchmark->type == kFloatingPointVariableTypeFloat)
+	{
+		benchmark->result = calculateMeanAndVarianceOfFloatSamples((const float *)benchmark->samples, benchmark->numberOfSamples);
+	}
+	else
+	{
+		benchmark->result = calculateMeanAndVarianceOfDoubleSamples((const double *)benchmark->samples, benchmark->numberOfSamples);
+	}
+	doNotOptimize(&benchmark->result);
+}
+
+static void
+benchmarkMeanAndVariance(const char *  name, size_t  numberOfSamples, FloatingPointVariableType  type)
+{
+	size_t				sampleSize = (type == kFloatingPointVariableTypeFloat) ? sizeof(float) : sizeof(double);
+	void *				samples = checkedMalloc(numberOfSamples * sampleSize, __FILE__, __LINE__);
+	MeanAndVarianceBenchmark	benchmark = {
+						.type = type,
+						.samples = samples,
+						.numberOfSamples = numberOfSamples,
+					};
+
+	if (type == kFloatingPointVariableTypeFloat)
+	{
+		fillBenchmarkFloatSamples((float *)samples, numberOfSamples, 4);
+	}
+	else
+	{
+		fillBenchmarkDoubleSamples((double *)samples, numberOfSamples, 4);
+	}
+
+	runAndPrintBenchmark(name, meanAndVarianceBenchmark, &benchmark, numberOfSamples * sampleSize, numberOfSamples);
+	free(samples);
+}
+
+int
+main(void)
+{
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfFloatSamples/1k", 1000, kFloatingPointVariableTypeFloat);
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfDoubleSamples/1k", 1000, kFloatingPointVariableTypeDouble);
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfFloatSamples/1M", 1000000, kFloatingPointVariableTypeFloat);
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfDoubleSamples/1M", 1000000, kFloatingPointVariableTypeDouble);
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfFloatSamples/16M", 16000000, kFloatingPointVariableTypeFloat);
+	benchmarkMeanAndVariance("calculateMeanAndVarianceOfDoubleSamples/16M", 16000000, kFloatingPointVariableTypeDouble);
+
+	return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "benchmarkDatasets.h"
+
+enum
+{
+	kBenchmarkMaxCharsPerHeader	= 24,
+	kBenchmarkPaddedRowInterval	= 97,
+	kBenchmarkMissingRowInterval	= 89,
+	kBenchmarkMaximumTotalSeconds	= 3,
+};
+
+/*
+ *	SplitMix64, so that the datasets do not depend on the C library's `rand()`.
+ */
+static uint64_t
+nextBenchmarkRandom(uint64_t *  state)
+{
+	uint64_t	z = (*state += UINT64_C(0x9e3779b97f4a7c15));
+
+	z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+	return z ^ (z >> 31);
+}
+
+/*
+ *	A sample of a normal distribution whose mean and standard deviation depend on
+ *	`column`, by the Box-Muller transform.
+ */
+static double
+nextBenchmarkSample(uint64_t *  state, size_t  column)
+{
+	double	u1 = ((double)(nextBenchmarkRandom(state) >> 11) + 1.0) * 0x1.0p-53;
+	double	u2 = (double)(nextBenchmarkRandom(state) >> 11) * 0x1.0p-53;
+	double	scale = pow(10.0, (double)(column % 7) - 3.0);
+
+	return scale * (10.0 * (double)(column % 5) + sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2));
+}
+
+const char **
+getBenchmarkHeaders(size_t  numberOfColumns)
+{
+	const char **	headers = (const char **)checkedMalloc(numberOfColumns * (sizeof(char *) + kBenchmarkMaxCharsPerHeader), __FILE__, __LINE__);
+	char *		names = (char *)(headers + numberOfColumns);
+
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		snprintf(names + i * kBenchmarkMaxCharsPerHeader, kBenchmarkMaxCharsPerHeader, "x%zu", i);
+		headers[i] = names + i * kBenchmarkMaxCharsPerHeader;
+	}
+
+	return headers;
+}
+
+CommonConstantReturnType
+writeBenchmarkCSV(
+	const char *	path,
+	size_t		numberOfRows,
+	size_t		numberOfColumns,
+	size_t		numberOfUxColumns,
+	uint64_t	seed,
+	uint64_t *	fileSize)
+{
+	static const char * const	formats[] = { "%.17g", "%.6f", "%.9g" };
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	uint64_t			state = seed;
+	char **				uxValues = NULL;
+	FILE *				fp;
+
+	fp = fopen(path, "w");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", path);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	uxValues = (char **)checkedCalloc(numberOfUxColumns + 1, sizeof(char *), __FILE__, __LINE__);
+	for (size_t i = 0; i < numberOfUxColumns; i++)
+	{
+		/*
+		 *	The shape of the text Signaloid processors print for a distribution: its
+		 *	mean and then its representation in hexadecimal.
+		 */
+		uxValues[i] = (char *)checkedMalloc(64, __FILE__, __LINE__);
+		snprintf(
+			uxValues[i],
+			64,
+			"%.6fUx%016" PRIx64 "%016" PRIx64,
+			nextBenchmarkSample(&state, i),
+			nextBenchmarkRandom(&state),
+			nextBenchmarkRandom(&state));
+	}
+
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		fprintf(fp, (i + 1 < numberOfColumns) ? "x%zu," : "x%zu\n", i);
+	}
+
+	for (size_t row = 0; row < numberOfRows; row++)
+	{
+		bool	isPadded = (row % kBenchmarkPaddedRowInterval == kBenchmarkPaddedRowInterval - 1);
+		bool	isMissing = (row % kBenchmarkMissingRowInterval == kBenchmarkMissingRowInterval - 1);
+
+		for (size_t i = 0; i < numberOfColumns; i++)
+		{
+			if (isPadded)
+			{
+				fputs("  ", fp);
+			}
+
+			if (i < numberOfUxColumns)
+			{
+				fputs(uxValues[i], fp);
+			}
+			else if (isMissing && (i == numberOfUxColumns))
+			{
+				fputc('-', fp);
+			}
+			else
+			{
+				fprintf(fp, formats[i % 3], nextBenchmarkSample(&state, i));
+			}
+
+			if (isPadded)
+			{
+				fputc(' ', fp);
+			}
+			fputc((i + 1 < numberOfColumns) ? ',' : '\n', fp);
+		}
+	}
+
+	if (ferror(fp))
+	{
+		fprintf(stderr, "Error: Could not write the file %s.\n", path);
+		goto cleanup;
+	}
+
+	returnCode = kCommonConstantReturnTypeSuccess;
+
+cleanup:
+
+	if ((fclose(fp) != 0) && (returnCode == kCommonConstantReturnTypeSuccess))
+	{
+		fprintf(stderr, "Error: Could not write the file %s.\n", path);
+		returnCode = kCommonConstantReturnTypeError;
+	}
+
+	for (size_t i = 0; i < numberOfUxColumns; i++)
+	{
+		free(uxValues[i]);
+	}
+	free(uxValues);
+
+	*fileSize = getBenchmarkFileSize(path);
+
+	return returnCode;
+}
+
+void
+fillBenchmarkFloatSamples(float *  samples, size_t  numberOfSamples, uint64_t  seed)
+{
+	uint64_t	state = seed;
+
+	for (size_t i = 0; i < numberOfSamples; i++)
+	{
+		samples[i] = (float)nextBenchmarkSample(&state, 3);
+	}
+}
+
+void
+fillBenchmarkDoubleSamples(double *  samples, size_t  numberOfSamples, uint64_t  seed)
+{
+	uint64_t	state = seed;
+
+	for (size_t i = 0; i < numberOfSamples; i++)
+	{
+		samples[i] = nextBenchmarkSample(&state, 3);
+	}
+}
+
+uint64_t
+getBenchmarkFileSize(const char *  path)
+{
+	struct stat	fileStatus;
+
+	flushOutputSinks();
+	if (stat(path, &fileStatus) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)fileStatus.st_size;
+}
+
+void
+getBenchmarkOptions(BenchmarkOptions *  options, uint64_t  bytesPerTrial, uint64_t  itemsPerTrial)
+{
+	getDefaultBenchmarkOptions(options);
+	options->maximumTotalMicroseconds = UINT64_C(1000000) * kBenchmarkMaximumTotalSeconds;
+	options->bytesPerTrial = bytesPerTrial;
+	options->itemsPerTrial = itemsPerTrial;
+}
+
+void
+runAndPrintBenchmark(
+	const char *		name,
+	BenchmarkFunction	function,
+	void *			context,
+	uint64_t		bytesPerTrial,
+	uint64_t		itemsPerTrial)
+{
+	BenchmarkOptions	options;
+	BenchmarkResult		result;
+
+	getBenchmarkOptions(&options, bytesPerTrial, itemsPerTrial);
+	if (runBenchmark(function, context, &options, &result) != kCommonConstantReturnTypeSuccess)
+	{
+		fatal("Invalid options for benchmark %s", name);
+	}
+
+	printBenchmarkResult(name, &result);
+}
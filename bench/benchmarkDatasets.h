@@ -0,0 +1,140 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ *	@brief	Get the column names of the CSV files of `writeBenchmarkCSV()`: "x0", "x1", ...
+ *
+ *	@param	numberOfColumns	Number of columns
+ *	@return			The names, in a single allocation released with `free()`
+ */
+const char **
+getBenchmarkHeaders(size_t  numberOfColumns);
+
+/**
+ *	@brief	Write a CSV file of `numberOfRows` data rows for the CSV readers.
+ *
+ *	@details The columns are named by `getBenchmarkHeaders()`. The first
+ *	`numberOfUxColumns` columns are Ux-value columns, with the same Ux-value text in
+ *	every row. The cells of the other columns are normally distributed samples,
+ *	written with "%.17g", "%.6f" or "%.9g" in turn, as the outputs of different
+ *	tools would be. A few rows have padding around their cells and a "-" for a
+ *	missing sample. The file only depends on the arguments.
+ *
+ *	@param	path			Path of the file to write
+ *	@param	numberOfRows		Number of data rows
+ *	@param	numberOfColumns		Number of columns
+ *	@param	numberOfUxColumns	Number of Ux-value columns, at most `numberOfColumns`
+ *	@param	seed			Seed of the samples
+ *	@param	fileSize		Set to the size of the file in bytes
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+writeBenchmarkCSV(
+	const char *	path,
+	size_t		numberOfRows,
+	size_t		numberOfColumns,
+	size_t		numberOfUxColumns,
+	uint64_t	seed,
+	uint64_t *	fileSize);
+
+/**
+ *	@brief	Fill `samples` with normally distributed single-precision samples.
+ *
+ *	@param	samples			Samples to fill
+ *	@param	numberOfSamples		Number of samples
+ *	@param	seed			Seed of the samples
+ */
+void
+fillBenchmarkFloatSamples(
+	float *		samples,
+	size_t		numberOfSamples,
+	uint64_t	seed);
+
+/**
+ *	@brief	Fill `samples` with normally distributed double-precision samples.
+ *
+ *	@param	samples			Samples to fill
+ *	@param	numberOfSamples		Number of samples
+ *	@param	seed			Seed of the samples
+ */
+void
+fillBenchmarkDoubleSamples(
+	double *	samples,
+	size_t		numberOfSamples,
+	uint64_t	seed);
+
+/**
+ *	@brief	Get the size of a file, once the output sinks have written it.
+ *
+ *	@param	path	Path of the file
+ *	@return		Size of the file in bytes, or 0 if it does not exist
+ */
+uint64_t
+getBenchmarkFileSize(const char *  path);
+
+/**
+ *	@brief	Set `options` to those of the benchmarks: the defaults of
+ *		`getDefaultBenchmarkOptions()`, with the total time of the trials limited to a
+ *		few seconds per benchmark, and the given throughput.
+ *
+ *	@param	options		Options to set
+ *	@param	bytesPerTrial	Bytes read or written by one trial, for `bytesPerSecond`
+ *	@param	itemsPerTrial	Rows, values or samples of one trial, for `itemsPerSecond`
+ */
+void
+getBenchmarkOptions(
+	BenchmarkOptions *	options,
+	uint64_t		bytesPerTrial,
+	uint64_t		itemsPerTrial);
+
+/**
+ *	@brief	Time `function` with `runBenchmark()` and print the result with `printBenchmarkResult()`.
+ *
+ *	@details Uses the options of `getBenchmarkOptions()`, and fails the program on
+ *	invalid options.
+ *
+ *	@param	name		Name of the benchmark, "routine/dataset"
+ *	@param	function	Code to time
+ *	@param	context		Passed to `function`
+ *	@param	bytesPerTrial	Bytes read or written by one call of `function`, for `bytesPerSecond`
+ *	@param	itemsPerTrial	Rows, values or samples of one call of `function`, for `itemsPerSecond`
+ */
+void
+runAndPrintBenchmark(
+	const char *		name,
+	BenchmarkFunction	function,
+	void *			context,
+	uint64_t		bytesPerTrial,
+	uint64_t		itemsPerTrial);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
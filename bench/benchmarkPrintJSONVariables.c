@@ -0,0 +1,139 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "benchmarkDatasets.h"
+
+/*
+ *	Benchmarks of `printJSONVariables()` on plain and particle variables, with both
+ *	particle encodings. The JSON goes to /dev/null while the trials run, and the size
+ *	of one document, measured by printing it to a file first, sets the throughput.
+ */
+
+enum
+{
+	kPrintJSONNumberOfValues	= 100000,
+};
+
+static void
+printJSONBenchmark(void *  context)
+{
+	printJSONVariables((JSONVariable *)context, 1, "Benchmark of printJSONVariables()");
+}
+
+/*
+ *	Point the standard output at `path` and return a descriptor of the standard output
+ *	from before, for `restoreStandardOutput()`.
+ */
+static int
+redirectStandardOutput(const char *  path)
+{
+	int	savedStandardOutput;
+	int	fd;
+
+	fflush(stdout);
+	savedStandardOutput = dup(STDOUT_FILENO);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if ((savedStandardOutput < 0) || (fd < 0) || (dup2(fd, STDOUT_FILENO) < 0))
+	{
+		fatal("Could not redirect the standard output to %s", path);
+	}
+	close(fd);
+
+	return savedStandardOutput;
+}
+
+static void
+restoreStandardOutput(int  savedStandardOutput)
+{
+	fflush(stdout);
+	if (dup2(savedStandardOutput, STDOUT_FILENO) < 0)
+	{
+		fatal("Could not restore the standard output");
+	}
+	close(savedStandardOutput);
+}
+
+static void
+benchmarkPrintJSON(const char *  name, JSONVariableType  type, const void *  values, JSONParticleEncoding  encoding)
+{
+	const char *		path = "benchmark-output.json";
+	JSONVariable		variable = { .type = type, .size = kPrintJSONNumberOfValues };
+	BenchmarkOptions	options;
+	BenchmarkResult		result;
+	uint64_t		documentSize;
+	int			savedStandardOutput;
+
+	snprintf(variable.variableSymbol, sizeof(variable.variableSymbol), "x");
+	snprintf(variable.variableDescription, sizeof(variable.variableDescription), "Samples of x");
+	if ((type == kJSONVariableTypeFloat) || (type == kJSONVariableTypeFloatParticle))
+	{
+		variable.values.asFloat = (const float *)values;
+	}
+	else
+	{
+		variable.values.asDouble = (const double *)values;
+	}
+	setJSONParticleEncoding(encoding);
+
+	savedStandardOutput = redirectStandardOutput(path);
+	printJSONBenchmark(&variable);
+	restoreStandardOutput(savedStandardOutput);
+	documentSize = getBenchmarkFileSize(path);
+	remove(path);
+
+	getBenchmarkOptions(&options, documentSize, kPrintJSONNumberOfValues);
+
+	savedStandardOutput = redirectStandardOutput("/dev/null");
+	if (runBenchmark(printJSONBenchmark, &variable, &options, &result) != kCommonConstantReturnTypeSuccess)
+	{
+		fatal("Invalid options for benchmark %s", name);
+	}
+	restoreStandardOutput(savedStandardOutput);
+
+	printBenchmarkResult(name, &result);
+}
+
+int
+main(void)
+{
+	float *		floatValues = (float *)checkedMalloc(kPrintJSONNumberOfValues * sizeof(float), __FILE__, __LINE__);
+	double *	doubleValues = (double *)checkedMalloc(kPrintJSONNumberOfValues * sizeof(double), __FILE__, __LINE__);
+
+	fillBenchmarkFloatSamples(floatValues, kPrintJSONNumberOfValues, 2);
+	fillBenchmarkDoubleSamples(doubleValues, kPrintJSONNumberOfValues, 2);
+
+	benchmarkPrintJSON("printJSONVariables/float", kJSONVariableTypeFloat, floatValues, kJSONParticleEncodingText);
+	benchmarkPrintJSON("printJSONVariables/double", kJSONVariableTypeDouble, doubleValues, kJSONParticleEncodingText);
+	benchmarkPrintJSON("printJSONVariables/floatParticleText", kJSONVariableTypeFloatParticle, floatValues, kJSONParticleEncodingText);
+	benchmarkPrintJSON("printJSONVariables/doubleParticleText", kJSONVariableTypeDoubleParticle, doubleValues, kJSONParticleEncodingText);
+	benchmarkPrintJSON("printJSONVariables/floatParticleBase64", kJSONVariableTypeFloatParticle, floatValues, kJSONParticleEncodingBase64);
+	benchmarkPrintJSON("printJSONVariables/doubleParticleBase64", kJSONVariableTypeDoubleParticle, doubleValues, kJSONParticleEncodingBase64);
+
+	free(floatValues);
+	free(doubleValues);
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "benchmarkDatasets.h"
+
+/*
+ *	Benchmarks of `readInputFloatDistributionsFromCSV()` and
+ *	`readInputDoubleDistributionsFromCSV()` on tall, wide and Ux-valued CSV files.
+ */
+
+typedef struct
+{
+	const char *			path;
+	const char **			headers;
+	size_t				numberOfColumns;
+	FloatingPointVariableType	type;
+	void *				distributions;
+} ReadInputBenchmark;
+
+static void
+readInputBenchmark(void *  context)
+{
+	ReadInputBenchmark *		benchmark = (ReadInputBenchmark *)context;
+	CommonConstantReturnType	returnCode;
+
+	if (benchmark->type == kFloatingPointVariableTypeFloat)
+	{
+		returnCode = readInputFloatDistributionsFromCSV(
+					benchmark->path,
+					benchmark->headers,
+					(float *)benchmark->distributions,
+					benchmark->numberOfColumns);
+	}
+	else
+	{
+		returnCode = readInputDoubleDistributionsFromCSV(
+					benchmark->path,
+					benchmark->headers,
+					(double *)benchmark->distributions,
+					benchmark->numberOfColumns);
+	}
+
+	if (returnCode != kCommonConstantReturnTypeSuccess)
+	{
+		fatal("Could not read %s", benchmark->path);
+	}
+	doNotOptimize(benchmark->distributions);
+}
+
+static void
+benchmarkReadInput(
+	const char *	name,
+	const char *	path,
+	size_t		numberOfRows,
+	size_t		numberOfColumns,
+	size_t		numberOfUxColumns)
+{
+	uint64_t		fileSize;
+	char			floatName[128];
+	char			doubleName[128];
+	ReadInputBenchmark	benchmark = {
+						.path = path,
+						.headers = getBenchmarkHeaders(numberOfColumns),
+						.numberOfColumns = numberOfColumns,
+						.distributions = checkedCalloc(numberOfColumns, sizeof(double), __FILE__, __LINE__),
+					};
+
+	if (writeBenchmarkCSV(path, numberOfRows, numberOfColumns, numberOfUxColumns, 1, &fileSize) != kCommonConstantReturnTypeSuccess)
+	{
+		fatal("Could not write %s", path);
+	}
+
+	snprintf(floatName, sizeof(floatName), "readInputFloatDistributionsFromCSV/%s", name);
+	benchmark.type = kFloatingPointVariableTypeFloat;
+	runAndPrintBenchmark(floatName, readInputBenchmark, &benchmark, fileSize, numberOfRows);
+
+	snprintf(doubleName, sizeof(doubleName), "readInputDoubleDistributionsFromCSV/%s", name);
+	benchmark.type = kFloatingPointVariableTypeDouble;
+	runAndPrintBenchmark(doubleName, readInputBenchmark, &benchmark, fileSize, numberOfRows);
+
+	free(benchmark.headers);
+	free(benchmark.distributions);
+	remove(path);
+}
+
+int
+main(void)
+{
+	benchmarkReadInput("tall", "benchmark-tall.csv", 200000, 4, 0);
+	benchmarkReadInput("wide", "benchmark-wide.csv", 500, 1000, 0);
+	benchmarkReadInput("ux", "benchmark-ux.csv", 50000, 16, 8);
+
+	return 0;
+}
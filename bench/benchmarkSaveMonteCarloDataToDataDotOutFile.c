@@ -0,0 +1,98 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "benchmarkDatasets.h"
+
+/*
+ *	Benchmarks of `saveMonteCarloFloatDataToDataDotOutFile()` and
+ *	`saveMonteCarloDoubleDataToDataDotOutFile()` in each output format, each trial up
+ *	to the file being written and closed by `flushOutputSinks()`.
+ */
+
+enum
+{
+	kSaveMonteCarloNumberOfSamples	= 1000000,
+};
+
+typedef struct
+{
+	FloatingPointVariableType	type;
+	const void *			samples;
+} SaveMonteCarloBenchmark;
+
+static void
+saveMonteCarloBenchmark(void *  context)
+{
+	SaveMonteCarloBenchmark *	benchmark = (SaveMonteCarloBenchmark *)context;
+
+	if (benchmark->type == kFloatingPointVariableTypeFloat)
+	{
+		saveMonteCarloFloatDataToDataDotOutFile((const float *)benchmark->samples, 1000, kSaveMonteCarloNumberOfSamples);
+	}
+	else
+	{
+		saveMonteCarloDoubleDataToDataDotOutFile((const double *)benchmark->samples, 1000, kSaveMonteCarloNumberOfSamples);
+	}
+
+	if (flushOutputSinks() != kCommonConstantReturnTypeSuccess)
+	{
+		fatal("Could not write the Monte Carlo samples file");
+	}
+}
+
+static void
+benchmarkSaveMonteCarlo(const char *  name, FloatingPointVariableType  type, const void *  samples, MonteCarloOutputFormat  format)
+{
+	const char *		path = "benchmark-data.out";
+	SaveMonteCarloBenchmark	benchmark = {
+						.type = type,
+						.samples = samples,
+					};
+
+	setMonteCarloOutput(path, format);
+	saveMonteCarloBenchmark(&benchmark);
+	runAndPrintBenchmark(name, saveMonteCarloBenchmark, &benchmark, getBenchmarkFileSize(path), kSaveMonteCarloNumberOfSamples);
+	remove(path);
+}
+
+int
+main(void)
+{
+	float *		floatSamples = (float *)checkedMalloc(kSaveMonteCarloNumberOfSamples * sizeof(float), __FILE__, __LINE__);
+	double *	doubleSamples = (double *)checkedMalloc(kSaveMonteCarloNumberOfSamples * sizeof(double), __FILE__, __LINE__);
+
+	fillBenchmarkFloatSamples(floatSamples, kSaveMonteCarloNumberOfSamples, 5);
+	fillBenchmarkDoubleSamples(doubleSamples, kSaveMonteCarloNumberOfSamples, 5);
+
+	benchmarkSaveMonteCarlo("saveMonteCarloFloatDataToDataDotOutFile/text", kFloatingPointVariableTypeFloat, floatSamples, kMonteCarloOutputFormatText);
+	benchmarkSaveMonteCarlo("saveMonteCarloDoubleDataToDataDotOutFile/text", kFloatingPointVariableTypeDouble, doubleSamples, kMonteCarloOutputFormatText);
+	benchmarkSaveMonteCarlo("saveMonteCarloFloatDataToDataDotOutFile/binary", kFloatingPointVariableTypeFloat, floatSamples, kMonteCarloOutputFormatBinary);
+	benchmarkSaveMonteCarlo("saveMonteCarloDoubleDataToDataDotOutFile/binary", kFloatingPointVariableTypeDouble, doubleSamples, kMonteCarloOutputFormatBinary);
+	benchmarkSaveMonteCarlo("saveMonteCarloFloatDataToDataDotOutFile/lz4", kFloatingPointVariableTypeFloat, floatSamples, kMonteCarloOutputFormatLZ4);
+	benchmarkSaveMonteCarlo("saveMonteCarloDoubleDataToDataDotOutFile/lz4", kFloatingPointVariableTypeDouble, doubleSamples, kMonteCarloOutputFormatLZ4);
+
+	free(floatSamples);
+	free(doubleSamples);
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "benchmarkDatasets.h"
+
+/*
+ *	Benchmarks of `writeOutputFloatDistributionsToCSV()` and
+ *	`writeOutputDoubleDistributionsToCSV()`, each trial up to the file being written
+ *	and closed by `flushOutputSinks()`.
+ */
+
+typedef struct
+{
+	const char *			path;
+	const char **			names;
+	size_t				numberOfVariables;
+	FloatingPointVariableType	type;
+	const void *			values;
+} WriteOutputBenchmark;
+
+static void
+writeOutputBenchmark(void *  context)
+{
+	WriteOutputBenchmark *		benchmark = (WriteOutputBenchmark *)context;
+	CommonConstantReturnType	returnCode;
+
+	if (benchmark->type == kFloatingPointVariableTypeFloat)
+	{
+		returnCode = writeOutputFloatDistributionsToCSV(
+					benchmark->path,
+					(const float *)benchmark->values,
+					benchmark->names,
+					benchmark->numberOfVariables);
+	}
+	else
+	{
+		returnCode = writeOutputDoubleDistributionsToCSV(
+					benchmark->path,
+					(const double *)benchmark->values,
+					benchmark->names,
+					benchmark->numberOfVariables);
+	}
+
+	if ((returnCode != kCommonConstantReturnTypeSuccess) || (flushOutputSinks() != kCommonConstantReturnTypeSuccess))
+	{
+		fatal("Could not write %s", benchmark->path);
+	}
+}
+
+static void
+benchmarkWriteOutput(const char *  name, size_t  numberOfVariables, FloatingPointVariableType  type)
+{
+	WriteOutputBenchmark	benchmark = {
+						.path = "benchmark-output.csv",
+						.names = getBenchmarkHeaders(numberOfVariables),
+						.numberOfVariables = numberOfVariables,
+						.type = type,
+					};
+	void *			values;
+
+	if (type == kFloatingPointVariableTypeFloat)
+	{
+		values = checkedMalloc(numberOfVariables * sizeof(float), __FILE__, __LINE__);
+		fillBenchmarkFloatSamples((float *)values, numberOfVariables, 3);
+	}
+	else
+	{
+		values = checkedMalloc(numberOfVariables * sizeof(double), __FILE__, __LINE__);
+		fillBenchmarkDoubleSamples((double *)values, numberOfVariables, 3);
+	}
+	benchmark.values = values;
+
+	writeOutputBenchmark(&benchmark);
+	runAndPrintBenchmark(name, writeOutputBenchmark, &benchmark, getBenchmarkFileSize(benchmark.path), numberOfVariables);
+
+	remove(benchmark.path);
+	free(benchmark.names);
+	free(values);
+}
+
+int
+main(void)
+{
+	benchmarkWriteOutput("writeOutputFloatDistributionsToCSV/narrow", 16, kFloatingPointVariableTypeFloat);
+	benchmarkWriteOutput("writeOutputDoubleDistributionsToCSV/narrow", 16, kFloatingPointVariableTypeDouble);
+	benchmarkWriteOutput("writeOutputFloatDistributionsToCSV/wide", 100000, kFloatingPointVariableTypeFloat);
+	benchmarkWriteOutput("writeOutputDoubleDistributionsToCSV/wide", 100000, kFloatingPointVariableTypeDouble);
+
+	return 0;
+}
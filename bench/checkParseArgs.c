@@ -0,0 +1,112 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+
+/*
+ *	Checks that `parseArgs()` keeps parsing the abbreviations of demo options that
+ *	`getopt_long_only` resolved before the library added common options sharing their
+ *	prefixes, and that those later common options are only parsed by their full names.
+ */
+
+typedef struct
+{
+	const char *	argument;
+	const char *	value;
+	const char *	expectedOption;
+	bool		isValid;
+} AbbreviationCheck;
+
+static const AbbreviationCheck	kAbbreviationChecks[] = {
+	{ "-w",			"2",		"window",	true },
+	{ "-wi=2",		NULL,		"window",	true },
+	{ "--win",		"2",		"window",	true },
+	{ "-d",			"2",		"dimension",	true },
+	{ "-dim=2",		NULL,		"dimension",	true },
+	{ "-data-out",		"2",		NULL,		true },
+	{ "-data",		"2",		NULL,		false },
+	{ "-p",			"2",		"precision",	true },
+	{ "-particle-encoding",	"base64",	NULL,		true },
+	{ "-part",		"base64",	NULL,		false },
+	{ "-worker-threads",	"2",		NULL,		true },
+	{ "-wo",		"2",		NULL,		false },
+	{ "-verb",		NULL,		NULL,		true },
+};
+
+int
+main(void)
+{
+	const char *	dimensionArg = NULL;
+	const char *	precisionArg = NULL;
+	const char *	windowArg = NULL;
+	DemoOption	demoOptions[] = {
+						{ "dimension",	NULL,	true,	&dimensionArg,	NULL },
+						{ "precision",	NULL,	true,	&precisionArg,	NULL },
+						{ "window",	NULL,	true,	&windowArg,	NULL },
+						{ ZERO_STRUCT_INIT }
+					};
+	DemoOptionTable *	optionTable = createDemoOptionTable();
+	int			numberOfFailures = 0;
+
+	for (size_t i = 0; i < sizeof(kAbbreviationChecks) / sizeof(kAbbreviationChecks[0]); i++)
+	{
+		const AbbreviationCheck *	check = &kAbbreviationChecks[i];
+		CommonCommandLineArguments	arguments;
+		char				argument[64];
+		char				value[64];
+		char *				argv[] = { "checkParseArgs", argument, value, NULL };
+		int				argc = (check->value != NULL) ? 3 : 2;
+		const char *			foundArg = NULL;
+		bool				isPassing;
+
+		snprintf(argument, sizeof(argument), "%s", check->argument);
+		snprintf(value, sizeof(value), "%s", (check->value != NULL) ? check->value : "");
+		isPassing = ((parseArgsWithOptionTable(argc, argv, &arguments, demoOptions, optionTable) == kCommonConstantReturnTypeSuccess) == check->isValid);
+
+		/*
+		 *	The table parses a copy of `argv`, so `argv` must be left as it was.
+		 */
+		isPassing = isPassing && (argv[1] == argument) && (strcmp(argument, check->argument) == 0);
+
+		if (check->expectedOption != NULL)
+		{
+			for (size_t j = 0; demoOptions[j].opt != NULL; j++)
+			{
+				if (strcmp(demoOptions[j].opt, check->expectedOption) == 0)
+				{
+					foundArg = *demoOptions[j].foundArg;
+				}
+			}
+			isPassing = isPassing && (foundArg != NULL) && (strcmp(foundArg, "2") == 0);
+		}
+
+		printf("%s: '%s'\n", isPassing ? "PASS" : "FAIL", check->argument);
+		numberOfFailures += isPassing ? 0 : 1;
+	}
+
+	destroyDemoOptionTable(optionTable);
+
+	return (numberOfFailures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,73 @@
+/*
+ *	Copyright (c) 2023, Signaloid.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+/*
+ *	Native stand-in for the Signaloid `uxhw.h`, for building the benchmarks and checks
+ *	in `bench/` with an ordinary C compiler. A distribution is represented by the
+ *	mean of its samples, so that building it reads every sample as it would on a
+ *	Signaloid processor, and its higher moments are zero. Values print as plain
+ *	numbers, so the particle modifier is empty.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#define SignaloidParticleModifier ""
+
+static inline double
+UxHwDoubleDistFromSamples(double *  samples, size_t  numberOfSamples)
+{
+	double	sum = 0;
+
+	for (size_t i = 0; i < numberOfSamples; i++)
+	{
+		sum += samples[i];
+	}
+
+	return (numberOfSamples > 0) ? sum / (double)numberOfSamples : 0;
+}
+
+static inline float
+UxHwFloatDistFromSamples(float *  samples, size_t  numberOfSamples)
+{
+	double	sum = 0;
+
+	for (size_t i = 0; i < numberOfSamples; i++)
+	{
+		sum += samples[i];
+	}
+
+	return (numberOfSamples > 0) ? (float)(sum / (double)numberOfSamples) : 0;
+}
+
+static inline double
+UxHwDoubleNthMoment(double  value, size_t  moment)
+{
+	return (moment == 1) ? value : 0;
+}
+
+static inline float
+UxHwFloatNthMoment(float  value, size_t  moment)
+{
+	return (moment == 1) ? value : 0;
+}
@@ -20,8 +20,24 @@
  *	SOFTWARE.
  */
 
+/*
+ *	A build restricted to strict POSIX (`-D_POSIX_C_SOURCE=...`) hides the XSI
+ *	`realpath()` used for input cache keys, so ask for XSI as well.
+ */
+#if defined(_POSIX_C_SOURCE) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+
+/*
+ *	Likewise on Linux for `syscall()`, which the performance counters need.
+ */
+#if defined(__linux__) && defined(_POSIX_C_SOURCE) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
 #include <ctype.h>
 #include <errno.h>
+#include <float.h>
 #include <getopt.h>
 #include <math.h>
 #include <stdio.h>
@@ -31,8 +47,86 @@
 #include <assert.h>
 #include <limits.h>
 #include <stdarg.h>
+#include <time.h>
 #include <uxhw.h>
 
+/*
+ *	Memory-mapped input is only used where POSIX advertises it (and never on newlib).
+ *	Everything else reads input through stdio.
+ */
+#if !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0)
+#define COMMON_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*
+ *	Likewise, CSV rows are only parsed and output files only written on worker
+ *	threads where POSIX threads exist.
+ */
+#if !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(_POSIX_THREADS) && (_POSIX_THREADS > 0)
+#define COMMON_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+/*
+ *	Output files are synced to storage before they are closed where `fsync()` exists.
+ */
+#if !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(_POSIX_FSYNC) && (_POSIX_FSYNC > 0)
+#define COMMON_HAVE_FSYNC
+#endif
+
+/*
+ *	A directory or glob pattern given as the input path is expanded where POSIX
+ *	provides `opendir()` and `glob()`.
+ */
+#if !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(_POSIX_VERSION)
+#define COMMON_HAVE_GLOB
+#include <dirent.h>
+#include <glob.h>
+#include <sys/stat.h>
+#endif
+
+/*
+ *	The peak resident set size for `runBenchmark()` where POSIX provides `getrusage()`.
+ */
+#if !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(_POSIX_VERSION)
+#define COMMON_HAVE_GETRUSAGE
+#include <sys/resource.h>
+#endif
+
+/*
+ *	Hardware performance counters for `runBenchmark()` where Linux provides
+ *	perf_event_open.
+ */
+#if defined(__linux__) && !defined(_NEWLIB_VERSION) && !defined(MOCK_NEWLIB_VERSION) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#define COMMON_HAVE_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+/*
+ *	Without a perf_event_open system call number, the counters are reported as
+ *	unavailable.
+ */
+#if defined(COMMON_HAVE_PERF_EVENTS) && !defined(SYS_perf_event_open)
+#undef COMMON_HAVE_PERF_EVENTS
+#endif
+
+/*
+ *	SIMD intrinsics for the CSV structural scanner. Without any of these it runs a
+ *	scalar loop.
+ */
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "common.h"
 
 /**
@@ -40,6 +134,7 @@
  *
  *	@param	inputFilePath		path to CSV file to read from
  *	@param	expectedHeaders		array of headers that should be in the CSV data
+ *	@param	isProjection		`true` to read only the columns named in `expectedHeaders`, wherever they are in the CSV data, `false` if the CSV data has exactly those columns in order
  *	@param	inputDistributions	array of input distributions to be obtained from the read CSV data
  *	@param	inputDistributionsType	specifies whether input data are single-precision or double-precision floating-point values
  *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
@@ -49,6 +144,27 @@ static CommonConstantReturnType
 readInputDistributionsFromCSV(
 	const char *			inputFilePath,
 	const char * const *		expectedHeaders,
+	bool				isProjection,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions);
+
+/**
+ *	@brief	Read data from a binary columns file. Columns hold either samples or a Ux-value.
+ *
+ *	@param	inputFilePath		path to binary columns file to read from
+ *	@param	expectedHeaders		array of column names that should be in the file
+ *	@param	isProjection		`true` to find each of `expectedHeaders` by name among the stored columns, `false` if the file holds exactly those columns in order
+ *	@param	inputDistributions	array of input distributions to be obtained from the file
+ *	@param	inputDistributionsType	specifies whether input data are single-precision or double-precision floating-point values
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+static CommonConstantReturnType
+readInputDistributionsFromBinaryColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
 	void *				inputDistributions,
 	FloatingPointVariableType	inputDistributionsType,
 	size_t				numberOfDistributions);
@@ -71,6 +187,19 @@ writeOutputDistributionsToCSV(
 	const char * const *		outputVariableNames,
 	size_t				numberOfOutputDistributions);
 
+/**
+ *	@brief	Seed a random number stream by SplitMix64.
+ *
+ *	@param	random		Stream to seed
+ *	@param	seed		Seed of the run the stream belongs to
+ *	@param	iteration	Index of the stream within the run
+ */
+static void
+seedMonteCarloRandom(
+	MonteCarloRandom *	random,
+	uint64_t		seed,
+	uint64_t		iteration);
+
 /*
  *	The implementation function is borrowed from googletest and prevents the compiler from
  *	optimising out the functionally redundant code. See
@@ -94,6 +223,148 @@ fatal(const char *  fmt, ...)
 	exit(EXIT_FAILURE);
 }
 
+static uint64_t
+getMonotonicMicroseconds(void)
+{
+#if defined(CLOCK_MONOTONIC)
+	struct timespec	now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+#else
+	/*
+	 *	Without a monotonic clock, fall back to the processor time, which is the
+	 *	wall time of a single-threaded program on a bare-metal target.
+	 */
+	return (uint64_t)clock() * 1000000 / CLOCKS_PER_SEC;
+#endif
+}
+
+static uint64_t
+getMonotonicNanoseconds(void)
+{
+#if defined(CLOCK_MONOTONIC)
+	struct timespec	now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+#else
+	return getMonotonicMicroseconds() * 1000;
+#endif
+}
+
+/*
+ *	Instrumentation totals, see `printInstrumentationSummary()`. They are updated
+ *	atomically, since input parsing and output writing run on worker threads.
+ */
+static uint64_t	instrumentationPhaseNanoseconds[kInstrumentationPhaseMax];
+static uint64_t	instrumentationPhaseCalls[kInstrumentationPhaseMax];
+static uint64_t	instrumentationCounters[kInstrumentationCounterMax];
+
+static const char *	kInstrumentationPhaseNames[kInstrumentationPhaseMax] = {
+				[kInstrumentationPhaseInputParsing]		= "inputParsing",
+				[kInstrumentationPhaseDistributionConstruction]	= "distributionConstruction",
+				[kInstrumentationPhaseKernel]			= "kernel",
+				[kInstrumentationPhaseOutput]			= "output",
+			};
+
+static const char *	kInstrumentationCounterNames[kInstrumentationCounterMax] = {
+				[kInstrumentationCounterBytesRead]		= "bytesRead",
+				[kInstrumentationCounterRowsParsed]		= "rowsParsed",
+				[kInstrumentationCounterAllocations]		= "allocations",
+				[kInstrumentationCounterBytesAllocated]		= "bytesAllocated",
+				[kInstrumentationCounterOutputBytes]		= "outputBytes",
+			};
+
+uint64_t
+beginInstrumentedPhase(void)
+{
+	return getMonotonicNanoseconds();
+}
+
+void
+endInstrumentedPhase(InstrumentationPhase  phase, uint64_t  startNanoseconds)
+{
+	__atomic_fetch_add(&instrumentationPhaseNanoseconds[phase], getMonotonicNanoseconds() - startNanoseconds, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&instrumentationPhaseCalls[phase], 1, __ATOMIC_RELAXED);
+}
+
+void
+addInstrumentationCount(InstrumentationCounter  counter, uint64_t  amount)
+{
+	__atomic_fetch_add(&instrumentationCounters[counter], amount, __ATOMIC_RELAXED);
+}
+
+void
+printInstrumentationSummary(bool  isJSON)
+{
+	if (isJSON)
+	{
+		fprintf(stderr, "{\"phases\": {");
+		for (int i = 0; i < kInstrumentationPhaseMax; i++)
+		{
+			fprintf(
+				stderr,
+				"%s\"%s\": {\"calls\": %" PRIu64 ", \"microseconds\": %.3f}",
+				(i > 0) ? ", " : "",
+				kInstrumentationPhaseNames[i],
+				__atomic_load_n(&instrumentationPhaseCalls[i], __ATOMIC_RELAXED),
+				(double)__atomic_load_n(&instrumentationPhaseNanoseconds[i], __ATOMIC_RELAXED) / 1000);
+		}
+		fprintf(stderr, "}, \"counters\": {");
+		for (int i = 0; i < kInstrumentationCounterMax; i++)
+		{
+			fprintf(
+				stderr,
+				"%s\"%s\": %" PRIu64,
+				(i > 0) ? ", " : "",
+				kInstrumentationCounterNames[i],
+				__atomic_load_n(&instrumentationCounters[i], __ATOMIC_RELAXED));
+		}
+		fprintf(stderr, "}}\n");
+
+		return;
+	}
+
+	fprintf(stderr, "%-28s %12s %16s\n", "Phase", "Calls", "Time (us)");
+	for (int i = 0; i < kInstrumentationPhaseMax; i++)
+	{
+		fprintf(
+			stderr,
+			"%-28s %12" PRIu64 " %16.3f\n",
+			kInstrumentationPhaseNames[i],
+			__atomic_load_n(&instrumentationPhaseCalls[i], __ATOMIC_RELAXED),
+			(double)__atomic_load_n(&instrumentationPhaseNanoseconds[i], __ATOMIC_RELAXED) / 1000);
+	}
+	fprintf(stderr, "%-28s %12s\n", "Counter", "Count");
+	for (int i = 0; i < kInstrumentationCounterMax; i++)
+	{
+		fprintf(
+			stderr,
+			"%-28s %12" PRIu64 "\n",
+			kInstrumentationCounterNames[i],
+			__atomic_load_n(&instrumentationCounters[i], __ATOMIC_RELAXED));
+	}
+}
+
+#ifdef COMMON_ENABLE_INSTRUMENTATION
+static bool	isInstrumentationSummaryJSON = false;
+
+static void
+printInstrumentationSummaryAtExit(void)
+{
+	printInstrumentationSummary(isInstrumentationSummaryJSON);
+}
+#endif /* COMMON_ENABLE_INSTRUMENTATION */
+
 CommonConstantReturnType
 parseIntChecked(const char *  str, int *  out)
 {
@@ -135,6 +406,61 @@ parseIntChecked(const char *  str, int *  out)
 	return kCommonConstantReturnTypeSuccess;
 }
 
+CommonConstantReturnType
+parseUint64Checked(const char *  str, uint64_t *  out)
+{
+	assert(str != NULL);
+	assert(out != NULL);
+
+	const char *		digits = str;
+	char *			end = NULL;
+	unsigned long long	tmp = 0;
+
+	while (isspace((unsigned char)*digits))
+	{
+		digits++;
+	}
+
+	if (*digits == '-')
+	{
+		/*
+		 *	`strtoull()` would negate the value in the unsigned type.
+		 */
+		return kCommonConstantReturnTypeError;
+	}
+
+	errno = 0;
+	tmp = strtoull(digits, &end, 10);
+
+	if (errno == ERANGE)
+	{
+		/*
+		 *	There was an integer but it was out of range.
+		 */
+		return kCommonConstantReturnTypeError;
+	}
+
+	if (end == digits)
+	{
+		/*
+		 *	No integer found in `str`.
+		 */
+		return kCommonConstantReturnTypeError;
+	}
+
+	if (tmp > UINT64_MAX)
+	{
+		/*
+		 *	Integer was in range for `unsigned long long` but not for `uint64_t`.
+		 */
+		return kCommonConstantReturnTypeError;
+	}
+
+	*out = (uint64_t)tmp;
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
 CommonConstantReturnType
 parseFloatChecked(const char *  str, float *  out)
 {
@@ -210,1242 +536,9336 @@ safeIsspace(char t)
 	return isspace((unsigned char)t);
 }
 
-static CommonConstantReturnType
-validateInputDistributionCSVHeader(
-	char * 			actualHeaderRow,
-	const char * const *	expectedHeaders,
-	size_t			numberOfExpectedHeaders)
+typedef enum
 {
-	assert(actualHeaderRow != NULL);
-	assert(expectedHeaders != NULL);
+	kDecimalParseSmallestPowerOfTen		= -342,
+	kDecimalParseLargestPowerOfTen		= 308,
+	kDecimalParseMaxSignificantDigits	= 19,
+	kDecimalParseMaxExponentMagnitude	= 100000,
+} DecimalParseConstant;
 
-	char *		strtokState;
-	size_t		columnCount = 0;
-	char *		token = strtok_r(actualHeaderRow, ",", &strtokState);
+/*
+ *	Truncated 128-bit approximations of 5^q, normalised so that the top bit is set, for
+ *	q in [kDecimalParseSmallestPowerOfTen, kDecimalParseLargestPowerOfTen]. Each entry
+ *	is { high 64 bits, low 64 bits }. These are the tables of the Eisel-Lemire algorithm
+ *	(D. Lemire, "Number Parsing at a Gigabyte per Second", 2021).
+ */
+static const uint64_t	powersOfFive128[][2] = {
+	{ 0xeef453d6923bd65a, 0x113faa2906a13b3f }, { 0x9558b4661b6565f8, 0x4ac7ca59a424c507 },
+	{ 0xbaaee17fa23ebf76, 0x5d79bcf00d2df649 }, { 0xe95a99df8ace6f53, 0xf4d82c2c107973dc },
+	{ 0x91d8a02bb6c10594, 0x79071b9b8a4be869 }, { 0xb64ec836a47146f9, 0x9748e2826cdee284 },
+	{ 0xe3e27a444d8d98b7, 0xfd1b1b2308169b25 }, { 0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7 },
+	{ 0xb208ef855c969f4f, 0xbdbd2d335e51a935 }, { 0xde8b2b66b3bc4723, 0xad2c788035e61382 },
+	{ 0x8b16fb203055ac76, 0x4c3bcb5021afcc31 }, { 0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d },
+	{ 0xd953e8624b85dd78, 0xd71d6dad34a2af0d }, { 0x87d4713d6f33aa6b, 0x8672648c40e5ad68 },
+	{ 0xa9c98d8ccb009506, 0x680efdaf511f18c2 }, { 0xd43bf0effdc0ba48, 0x0212bd1b2566def2 },
+	{ 0x84a57695fe98746d, 0x014bb630f7604b57 }, { 0xa5ced43b7e3e9188, 0x419ea3bd35385e2d },
+	{ 0xcf42894a5dce35ea, 0x52064cac828675b9 }, { 0x818995ce7aa0e1b2, 0x7343efebd1940993 },
+	{ 0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8 }, { 0xca66fa129f9b60a6, 0xd41a26e077774ef6 },
+	{ 0xfd00b897478238d0, 0x8920b098955522b4 }, { 0x9e20735e8cb16382, 0x55b46e5f5d5535b0 },
+	{ 0xc5a890362fddbc62, 0xeb2189f734aa831d }, { 0xf712b443bbd52b7b, 0xa5e9ec7501d523e4 },
+	{ 0x9a6bb0aa55653b2d, 0x47b233c92125366e }, { 0xc1069cd4eabe89f8, 0x999ec0bb696e840a },
+	{ 0xf148440a256e2c76, 0xc00670ea43ca250d }, { 0x96cd2a865764dbca, 0x380406926a5e5728 },
+	{ 0xbc807527ed3e12bc, 0xc605083704f5ecf2 }, { 0xeba09271e88d976b, 0xf7864a44c633682e },
+	{ 0x93445b8731587ea3, 0x7ab3ee6afbe0211d }, { 0xb8157268fdae9e4c, 0x5960ea05bad82964 },
+	{ 0xe61acf033d1a45df, 0x6fb92487298e33bd }, { 0x8fd0c16206306bab, 0xa5d3b6d479f8e056 },
+	{ 0xb3c4f1ba87bc8696, 0x8f48a4899877186c }, { 0xe0b62e2929aba83c, 0x331acdabfe94de87 },
+	{ 0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14 }, { 0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9 },
+	{ 0xdb71e91432b1a24a, 0xc9e82cd9f69d6150 }, { 0x892731ac9faf056e, 0xbe311c083a225cd2 },
+	{ 0xab70fe17c79ac6ca, 0x6dbd630a48aaf406 }, { 0xd64d3d9db981787d, 0x092cbbccdad5b108 },
+	{ 0x85f0468293f0eb4e, 0x25bbf56008c58ea5 }, { 0xa76c582338ed2621, 0xaf2af2b80af6f24e },
+	{ 0xd1476e2c07286faa, 0x1af5af660db4aee1 }, { 0x82cca4db847945ca, 0x50d98d9fc890ed4d },
+	{ 0xa37fce126597973c, 0xe50ff107bab528a0 }, { 0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8 },
+	{ 0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a }, { 0x9faacf3df73609b1, 0x77b191618c54e9ac },
+	{ 0xc795830d75038c1d, 0xd59df5b9ef6a2417 }, { 0xf97ae3d0d2446f25, 0x4b0573286b44ad1d },
+	{ 0x9becce62836ac577, 0x4ee367f9430aec32 }, { 0xc2e801fb244576d5, 0x229c41f793cda73f },
+	{ 0xf3a20279ed56d48a, 0x6b43527578c1110f }, { 0x9845418c345644d6, 0x830a13896b78aaa9 },
+	{ 0xbe5691ef416bd60c, 0x23cc986bc656d553 }, { 0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8 },
+	{ 0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9 }, { 0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53 },
+	{ 0xe858ad248f5c22c9, 0xd1b3400f8f9cff68 }, { 0x91376c36d99995be, 0x23100809b9c21fa1 },
+	{ 0xb58547448ffffb2d, 0xabd40a0c2832a78a }, { 0xe2e69915b3fff9f9, 0x16c90c8f323f516c },
+	{ 0x8dd01fad907ffc3b, 0xae3da7d97f6792e3 }, { 0xb1442798f49ffb4a, 0x99cd11cfdf41779c },
+	{ 0xdd95317f31c7fa1d, 0x40405643d711d583 }, { 0x8a7d3eef7f1cfc52, 0x482835ea666b2572 },
+	{ 0xad1c8eab5ee43b66, 0xda3243650005eecf }, { 0xd863b256369d4a40, 0x90bed43e40076a82 },
+	{ 0x873e4f75e2224e68, 0x5a7744a6e804a291 }, { 0xa90de3535aaae202, 0x711515d0a205cb36 },
+	{ 0xd3515c2831559a83, 0x0d5a5b44ca873e03 }, { 0x8412d9991ed58091, 0xe858790afe9486c2 },
+	{ 0xa5178fff668ae0b6, 0x626e974dbe39a872 }, { 0xce5d73ff402d98e3, 0xfb0a3d212dc8128f },
+	{ 0x80fa687f881c7f8e, 0x7ce66634bc9d0b99 }, { 0xa139029f6a239f72, 0x1c1fffc1ebc44e80 },
+	{ 0xc987434744ac874e, 0xa327ffb266b56220 }, { 0xfbe9141915d7a922, 0x4bf1ff9f0062baa8 },
+	{ 0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9 }, { 0xc4ce17b399107c22, 0xcb550fb4384d21d3 },
+	{ 0xf6019da07f549b2b, 0x7e2a53a146606a48 }, { 0x99c102844f94e0fb, 0x2eda7444cbfc426d },
+	{ 0xc0314325637a1939, 0xfa911155fefb5308 }, { 0xf03d93eebc589f88, 0x793555ab7eba27ca },
+	{ 0x96267c7535b763b5, 0x4bc1558b2f3458de }, { 0xbbb01b9283253ca2, 0x9eb1aaedfb016f16 },
+	{ 0xea9c227723ee8bcb, 0x465e15a979c1cadc }, { 0x92a1958a7675175f, 0x0bfacd89ec191ec9 },
+	{ 0xb749faed14125d36, 0xcef980ec671f667b }, { 0xe51c79a85916f484, 0x82b7e12780e7401a },
+	{ 0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810 }, { 0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15 },
+	{ 0xdfbdcece67006ac9, 0x67a791e093e1d49a }, { 0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0 },
+	{ 0xaecc49914078536d, 0x58fae9f773886e18 }, { 0xda7f5bf590966848, 0xaf39a475506a899e },
+	{ 0x888f99797a5e012d, 0x6d8406c952429603 }, { 0xaab37fd7d8f58178, 0xc8e5087ba6d33b83 },
+	{ 0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64 }, { 0x855c3be0a17fcd26, 0x5cf2eea09a55067f },
+	{ 0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e }, { 0xd0601d8efc57b08b, 0xf13b94daf124da26 },
+	{ 0x823c12795db6ce57, 0x76c53d08d6b70858 }, { 0xa2cb1717b52481ed, 0x54768c4b0c64ca6e },
+	{ 0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09 }, { 0xfe5d54150b090b02, 0xd3f93b35435d7c4c },
+	{ 0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf }, { 0xc6b8e9b0709f109a, 0x359ab6419ca1091b },
+	{ 0xf867241c8cc6d4c0, 0xc30163d203c94b62 }, { 0x9b407691d7fc44f8, 0x79e0de63425dcf1d },
+	{ 0xc21094364dfb5636, 0x985915fc12f542e4 }, { 0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d },
+	{ 0x979cf3ca6cec5b5a, 0xa705992ceecf9c42 }, { 0xbd8430bd08277231, 0x50c6ff782a838353 },
+	{ 0xece53cec4a314ebd, 0xa4f8bf5635246428 }, { 0x940f4613ae5ed136, 0x871b7795e136be99 },
+	{ 0xb913179899f68584, 0x28e2557b59846e3f }, { 0xe757dd7ec07426e5, 0x331aeada2fe589cf },
+	{ 0x9096ea6f3848984f, 0x3ff0d2c85def7621 }, { 0xb4bca50b065abe63, 0x0fed077a756b53a9 },
+	{ 0xe1ebce4dc7f16dfb, 0xd3e8495912c62894 }, { 0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c },
+	{ 0xb080392cc4349dec, 0xbd8d794d96aacfb3 }, { 0xdca04777f541c567, 0xecf0d7a0fc5583a0 },
+	{ 0x89e42caaf9491b60, 0xf41686c49db57244 }, { 0xac5d37d5b79b6239, 0x311c2875c522ced5 },
+	{ 0xd77485cb25823ac7, 0x7d633293366b828b }, { 0x86a8d39ef77164bc, 0xae5dff9c02033197 },
+	{ 0xa8530886b54dbdeb, 0xd9f57f830283fdfc }, { 0xd267caa862a12d66, 0xd072df63c324fd7b },
+	{ 0x8380dea93da4bc60, 0x4247cb9e59f71e6d }, { 0xa46116538d0deb78, 0x52d9be85f074e608 },
+	{ 0xcd795be870516656, 0x67902e276c921f8b }, { 0x806bd9714632dff6, 0x00ba1cd8a3db53b6 },
+	{ 0xa086cfcd97bf97f3, 0x80e8a40eccd228a4 }, { 0xc8a883c0fdaf7df0, 0x6122cd128006b2cd },
+	{ 0xfad2a4b13d1b5d6c, 0x796b805720085f81 }, { 0x9cc3a6eec6311a63, 0xcbe3303674053bb0 },
+	{ 0xc3f490aa77bd60fc, 0xbedbfc4411068a9c }, { 0xf4f1b4d515acb93b, 0xee92fb5515482d44 },
+	{ 0x991711052d8bf3c5, 0x751bdd152d4d1c4a }, { 0xbf5cd54678eef0b6, 0xd262d45a78a0635d },
+	{ 0xef340a98172aace4, 0x86fb897116c87c34 }, { 0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0 },
+	{ 0xbae0a846d2195712, 0x8974836059cca109 }, { 0xe998d258869facd7, 0x2bd1a438703fc94b },
+	{ 0x91ff83775423cc06, 0x7b6306a34627ddcf }, { 0xb67f6455292cbf08, 0x1a3bc84c17b1d542 },
+	{ 0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93 }, { 0x8e938662882af53e, 0x547eb47b7282ee9c },
+	{ 0xb23867fb2a35b28d, 0xe99e619a4f23aa43 }, { 0xdec681f9f4c31f31, 0x6405fa00e2ec94d4 },
+	{ 0x8b3c113c38f9f37e, 0xde83bc408dd3dd04 }, { 0xae0b158b4738705e, 0x9624ab50b148d445 },
+	{ 0xd98ddaee19068c76, 0x3badd624dd9b0957 }, { 0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6 },
+	{ 0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c }, { 0xd47487cc8470652b, 0x7647c3200069671f },
+	{ 0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073 }, { 0xa5fb0a17c777cf09, 0xf468107100525890 },
+	{ 0xcf79cc9db955c2cc, 0x7182148d4066eeb4 }, { 0x81ac1fe293d599bf, 0xc6f14cd848405530 },
+	{ 0xa21727db38cb002f, 0xb8ada00e5a506a7c }, { 0xca9cf1d206fdc03b, 0xa6d90811f0e4851c },
+	{ 0xfd442e4688bd304a, 0x908f4a166d1da663 }, { 0x9e4a9cec15763e2e, 0x9a598e4e043287fe },
+	{ 0xc5dd44271ad3cdba, 0x40eff1e1853f29fd }, { 0xf7549530e188c128, 0xd12bee59e68ef47c },
+	{ 0x9a94dd3e8cf578b9, 0x82bb74f8301958ce }, { 0xc13a148e3032d6e7, 0xe36a52363c1faf01 },
+	{ 0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1 }, { 0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9 },
+	{ 0xbcb2b812db11a5de, 0x7415d448f6b6f0e7 }, { 0xebdf661791d60f56, 0x111b495b3464ad21 },
+	{ 0x936b9fcebb25c995, 0xcab10dd900beec34 }, { 0xb84687c269ef3bfb, 0x3d5d514f40eea742 },
+	{ 0xe65829b3046b0afa, 0x0cb4a5a3112a5112 }, { 0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab },
+	{ 0xb3f4e093db73a093, 0x59ed216765690f56 }, { 0xe0f218b8d25088b8, 0x306869c13ec3532c },
+	{ 0x8c974f7383725573, 0x1e414218c73a13fb }, { 0xafbd2350644eeacf, 0xe5d1929ef90898fa },
+	{ 0xdbac6c247d62a583, 0xdf45f746b74abf39 }, { 0x894bc396ce5da772, 0x6b8bba8c328eb783 },
+	{ 0xab9eb47c81f5114f, 0x066ea92f3f326564 }, { 0xd686619ba27255a2, 0xc80a537b0efefebd },
+	{ 0x8613fd0145877585, 0xbd06742ce95f5f36 }, { 0xa798fc4196e952e7, 0x2c48113823b73704 },
+	{ 0xd17f3b51fca3a7a0, 0xf75a15862ca504c5 }, { 0x82ef85133de648c4, 0x9a984d73dbe722fb },
+	{ 0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba }, { 0xcc963fee10b7d1b3, 0x318df905079926a8 },
+	{ 0xffbbcfe994e5c61f, 0xfdf17746497f7052 }, { 0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633 },
+	{ 0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0 }, { 0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0 },
+	{ 0x9c1661a651213e2d, 0x06bea10ca65c084e }, { 0xc31bfa0fe5698db8, 0x486e494fcff30a62 },
+	{ 0xf3e2f893dec3f126, 0x5a89dba3c3efccfa }, { 0x986ddb5c6b3a76b7, 0xf89629465a75e01c },
+	{ 0xbe89523386091465, 0xf6bbb397f1135823 }, { 0xee2ba6c0678b597f, 0x746aa07ded582e2c },
+	{ 0x94db483840b717ef, 0xa8c2a44eb4571cdc }, { 0xba121a4650e4ddeb, 0x92f34d62616ce413 },
+	{ 0xe896a0d7e51e1566, 0x77b020baf9c81d17 }, { 0x915e2486ef32cd60, 0x0ace1474dc1d122e },
+	{ 0xb5b5ada8aaff80b8, 0x0d819992132456ba }, { 0xe3231912d5bf60e6, 0x10e1fff697ed6c69 },
+	{ 0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1 }, { 0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2 },
+	{ 0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde }, { 0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b },
+	{ 0xad4ab7112eb3929d, 0x86c16c98d2c953c6 }, { 0xd89d64d57a607744, 0xe871c7bf077ba8b7 },
+	{ 0x87625f056c7c4a8b, 0x11471cd764ad4972 }, { 0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf },
+	{ 0xd389b47879823479, 0x4aff1d108d4ec2c3 }, { 0x843610cb4bf160cb, 0xcedf722a585139ba },
+	{ 0xa54394fe1eedb8fe, 0xc2974eb4ee658828 }, { 0xce947a3da6a9273e, 0x733d226229feea32 },
+	{ 0x811ccc668829b887, 0x0806357d5a3f525f }, { 0xa163ff802a3426a8, 0xca07c2dcb0cf26f7 },
+	{ 0xc9bcff6034c13052, 0xfc89b393dd02f0b5 }, { 0xfc2c3f3841f17c67, 0xbbac2078d443ace2 },
+	{ 0x9d9ba7832936edc0, 0xd54b944b84aa4c0d }, { 0xc5029163f384a931, 0x0a9e795e65d4df11 },
+	{ 0xf64335bcf065d37d, 0x4d4617b5ff4a16d5 }, { 0x99ea0196163fa42e, 0x504bced1bf8e4e45 },
+	{ 0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6 }, { 0xf07da27a82c37088, 0x5d767327bb4e5a4c },
+	{ 0x964e858c91ba2655, 0x3a6a07f8d510f86f }, { 0xbbe226efb628afea, 0x890489f70a55368b },
+	{ 0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e }, { 0x92c8ae6b464fc96f, 0x3b0b8bc90012929d },
+	{ 0xb77ada0617e3bbcb, 0x09ce6ebb40173744 }, { 0xe55990879ddcaabd, 0xcc420a6a101d0515 },
+	{ 0x8f57fa54c2a9eab6, 0x9fa946824a12232d }, { 0xb32df8e9f3546564, 0x47939822dc96abf9 },
+	{ 0xdff9772470297ebd, 0x59787e2b93bc56f7 }, { 0x8bfbea76c619ef36, 0x57eb4edb3c55b65a },
+	{ 0xaefae51477a06b03, 0xede622920b6b23f1 }, { 0xdab99e59958885c4, 0xe95fab368e45eced },
+	{ 0x88b402f7fd75539b, 0x11dbcb0218ebb414 }, { 0xaae103b5fcd2a881, 0xd652bdc29f26a119 },
+	{ 0xd59944a37c0752a2, 0x4be76d3346f0495f }, { 0x857fcae62d8493a5, 0x6f70a4400c562ddb },
+	{ 0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952 }, { 0xd097ad07a71f26b2, 0x7e2000a41346a7a7 },
+	{ 0x825ecc24c873782f, 0x8ed400668c0c28c8 }, { 0xa2f67f2dfa90563b, 0x728900802f0f32fa },
+	{ 0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9 }, { 0xfea126b7d78186bc, 0xe2f610c84987bfa8 },
+	{ 0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9 }, { 0xc6ede63fa05d3143, 0x91503d1c79720dbb },
+	{ 0xf8a95fcf88747d94, 0x75a44c6397ce912a }, { 0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba },
+	{ 0xc24452da229b021b, 0xfbe85badce996168 }, { 0xf2d56790ab41c2a2, 0xfae27299423fb9c3 },
+	{ 0x97c560ba6b0919a5, 0xdccd879fc967d41a }, { 0xbdb6b8e905cb600f, 0x5400e987bbc1c920 },
+	{ 0xed246723473e3813, 0x290123e9aab23b68 }, { 0x9436c0760c86e30b, 0xf9a0b6720aaf6521 },
+	{ 0xb94470938fa89bce, 0xf808e40e8d5b3e69 }, { 0xe7958cb87392c2c2, 0xb60b1d1230b20e04 },
+	{ 0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2 }, { 0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3 },
+	{ 0xe2280b6c20dd5232, 0x25c6da63c38de1b0 }, { 0x8d590723948a535f, 0x579c487e5a38ad0e },
+	{ 0xb0af48ec79ace837, 0x2d835a9df0c6d851 }, { 0xdcdb1b2798182244, 0xf8e431456cf88e65 },
+	{ 0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff }, { 0xac8b2d36eed2dac5, 0xe272467e3d222f3f },
+	{ 0xd7adf884aa879177, 0x5b0ed81dcc6abb0f }, { 0x86ccbb52ea94baea, 0x98e947129fc2b4e9 },
+	{ 0xa87fea27a539e9a5, 0x3f2398d747b36224 }, { 0xd29fe4b18e88640e, 0x8eec7f0d19a03aad },
+	{ 0x83a3eeeef9153e89, 0x1953cf68300424ac }, { 0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7 },
+	{ 0xcdb02555653131b6, 0x3792f412cb06794d }, { 0x808e17555f3ebf11, 0xe2bbd88bbee40bd0 },
+	{ 0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4 }, { 0xc8de047564d20a8b, 0xf245825a5a445275 },
+	{ 0xfb158592be068d2e, 0xeed6e2f0f0d56712 }, { 0x9ced737bb6c4183d, 0x55464dd69685606b },
+	{ 0xc428d05aa4751e4c, 0xaa97e14c3c26b886 }, { 0xf53304714d9265df, 0xd53dd99f4b3066a8 },
+	{ 0x993fe2c6d07b7fab, 0xe546a8038efe4029 }, { 0xbf8fdb78849a5f96, 0xde98520472bdd033 },
+	{ 0xef73d256a5c0f77c, 0x963e66858f6d4440 }, { 0x95a8637627989aad, 0xdde7001379a44aa8 },
+	{ 0xbb127c53b17ec159, 0x5560c018580d5d52 }, { 0xe9d71b689dde71af, 0xaab8f01e6e10b4a6 },
+	{ 0x9226712162ab070d, 0xcab3961304ca70e8 }, { 0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22 },
+	{ 0xe45c10c42a2b3b05, 0x8cb89a7db77c506a }, { 0x8eb98a7a9a5b04e3, 0x77f3608e92adb242 },
+	{ 0xb267ed1940f1c61c, 0x55f038b237591ed3 }, { 0xdf01e85f912e37a3, 0x6b6c46dec52f6688 },
+	{ 0x8b61313bbabce2c6, 0x2323ac4b3b3da015 }, { 0xae397d8aa96c1b77, 0xabec975e0a0d081a },
+	{ 0xd9c7dced53c72255, 0x96e7bd358c904a21 }, { 0x881cea14545c7575, 0x7e50d64177da2e54 },
+	{ 0xaa242499697392d2, 0xdde50bd1d5d0b9e9 }, { 0xd4ad2dbfc3d07787, 0x955e4ec64b44e864 },
+	{ 0x84ec3c97da624ab4, 0xbd5af13bef0b113e }, { 0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e },
+	{ 0xcfb11ead453994ba, 0x67de18eda5814af2 }, { 0x81ceb32c4b43fcf4, 0x80eacf948770ced7 },
+	{ 0xa2425ff75e14fc31, 0xa1258379a94d028d }, { 0xcad2f7f5359a3b3e, 0x096ee45813a04330 },
+	{ 0xfd87b5f28300ca0d, 0x8bca9d6e188853fc }, { 0x9e74d1b791e07e48, 0x775ea264cf55347e },
+	{ 0xc612062576589dda, 0x95364afe032a819e }, { 0xf79687aed3eec551, 0x3a83ddbd83f52205 },
+	{ 0x9abe14cd44753b52, 0xc4926a9672793543 }, { 0xc16d9a0095928a27, 0x75b7053c0f178294 },
+	{ 0xf1c90080baf72cb1, 0x5324c68b12dd6339 }, { 0x971da05074da7bee, 0xd3f6fc16ebca5e04 },
+	{ 0xbce5086492111aea, 0x88f4bb1ca6bcf585 }, { 0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6 },
+	{ 0x9392ee8e921d5d07, 0x3aff322e62439fd0 }, { 0xb877aa3236a4b449, 0x09befeb9fad487c3 },
+	{ 0xe69594bec44de15b, 0x4c2ebe687989a9b4 }, { 0x901d7cf73ab0acd9, 0x0f9d37014bf60a11 },
+	{ 0xb424dc35095cd80f, 0x538484c19ef38c95 }, { 0xe12e13424bb40e13, 0x2865a5f206b06fba },
+	{ 0x8cbccc096f5088cb, 0xf93f87b7442e45d4 }, { 0xafebff0bcb24aafe, 0xf78f69a51539d749 },
+	{ 0xdbe6fecebdedd5be, 0xb573440e5a884d1c }, { 0x89705f4136b4a597, 0x31680a88f8953031 },
+	{ 0xabcc77118461cefc, 0xfdc20d2b36ba7c3e }, { 0xd6bf94d5e57a42bc, 0x3d32907604691b4d },
+	{ 0x8637bd05af6c69b5, 0xa63f9a49c2c1b110 }, { 0xa7c5ac471b478423, 0x0fcf80dc33721d54 },
+	{ 0xd1b71758e219652b, 0xd3c36113404ea4a9 }, { 0x83126e978d4fdf3b, 0x645a1cac083126ea },
+	{ 0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4 }, { 0xcccccccccccccccc, 0xcccccccccccccccd },
+	{ 0x8000000000000000, 0x0000000000000000 }, { 0xa000000000000000, 0x0000000000000000 },
+	{ 0xc800000000000000, 0x0000000000000000 }, { 0xfa00000000000000, 0x0000000000000000 },
+	{ 0x9c40000000000000, 0x0000000000000000 }, { 0xc350000000000000, 0x0000000000000000 },
+	{ 0xf424000000000000, 0x0000000000000000 }, { 0x9896800000000000, 0x0000000000000000 },
+	{ 0xbebc200000000000, 0x0000000000000000 }, { 0xee6b280000000000, 0x0000000000000000 },
+	{ 0x9502f90000000000, 0x0000000000000000 }, { 0xba43b74000000000, 0x0000000000000000 },
+	{ 0xe8d4a51000000000, 0x0000000000000000 }, { 0x9184e72a00000000, 0x0000000000000000 },
+	{ 0xb5e620f480000000, 0x0000000000000000 }, { 0xe35fa931a0000000, 0x0000000000000000 },
+	{ 0x8e1bc9bf04000000, 0x0000000000000000 }, { 0xb1a2bc2ec5000000, 0x0000000000000000 },
+	{ 0xde0b6b3a76400000, 0x0000000000000000 }, { 0x8ac7230489e80000, 0x0000000000000000 },
+	{ 0xad78ebc5ac620000, 0x0000000000000000 }, { 0xd8d726b7177a8000, 0x0000000000000000 },
+	{ 0x878678326eac9000, 0x0000000000000000 }, { 0xa968163f0a57b400, 0x0000000000000000 },
+	{ 0xd3c21bcecceda100, 0x0000000000000000 }, { 0x84595161401484a0, 0x0000000000000000 },
+	{ 0xa56fa5b99019a5c8, 0x0000000000000000 }, { 0xcecb8f27f4200f3a, 0x0000000000000000 },
+	{ 0x813f3978f8940984, 0x4000000000000000 }, { 0xa18f07d736b90be5, 0x5000000000000000 },
+	{ 0xc9f2c9cd04674ede, 0xa400000000000000 }, { 0xfc6f7c4045812296, 0x4d00000000000000 },
+	{ 0x9dc5ada82b70b59d, 0xf020000000000000 }, { 0xc5371912364ce305, 0x6c28000000000000 },
+	{ 0xf684df56c3e01bc6, 0xc732000000000000 }, { 0x9a130b963a6c115c, 0x3c7f400000000000 },
+	{ 0xc097ce7bc90715b3, 0x4b9f100000000000 }, { 0xf0bdc21abb48db20, 0x1e86d40000000000 },
+	{ 0x96769950b50d88f4, 0x1314448000000000 }, { 0xbc143fa4e250eb31, 0x17d955a000000000 },
+	{ 0xeb194f8e1ae525fd, 0x5dcfab0800000000 }, { 0x92efd1b8d0cf37be, 0x5aa1cae500000000 },
+	{ 0xb7abc627050305ad, 0xf14a3d9e40000000 }, { 0xe596b7b0c643c719, 0x6d9ccd05d0000000 },
+	{ 0x8f7e32ce7bea5c6f, 0xe4820023a2000000 }, { 0xb35dbf821ae4f38b, 0xdda2802c8a800000 },
+	{ 0xe0352f62a19e306e, 0xd50b2037ad200000 }, { 0x8c213d9da502de45, 0x4526f422cc340000 },
+	{ 0xaf298d050e4395d6, 0x9670b12b7f410000 }, { 0xdaf3f04651d47b4c, 0x3c0cdd765f114000 },
+	{ 0x88d8762bf324cd0f, 0xa5880a69fb6ac800 }, { 0xab0e93b6efee0053, 0x8eea0d047a457a00 },
+	{ 0xd5d238a4abe98068, 0x72a4904598d6d880 }, { 0x85a36366eb71f041, 0x47a6da2b7f864750 },
+	{ 0xa70c3c40a64e6c51, 0x999090b65f67d924 }, { 0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d },
+	{ 0x82818f1281ed449f, 0xbff8f10e7a8921a4 }, { 0xa321f2d7226895c7, 0xaff72d52192b6a0d },
+	{ 0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490 }, { 0xfee50b7025c36a08, 0x02f236d04753d5b4 },
+	{ 0x9f4f2726179a2245, 0x01d762422c946590 }, { 0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5 },
+	{ 0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2 }, { 0x9b934c3b330c8577, 0x63cc55f49f88eb2f },
+	{ 0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb }, { 0xf316271c7fc3908a, 0x8bef464e3945ef7a },
+	{ 0x97edd871cfda3a56, 0x97758bf0e3cbb5ac }, { 0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317 },
+	{ 0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd }, { 0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a },
+	{ 0xb975d6b6ee39e436, 0xb3e2fd538e122b44 }, { 0xe7d34c64a9c85d44, 0x60dbbca87196b616 },
+	{ 0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd }, { 0xb51d13aea4a488dd, 0x6babab6398bdbe41 },
+	{ 0xe264589a4dcdab14, 0xc696963c7eed2dd1 }, { 0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2 },
+	{ 0xb0de65388cc8ada8, 0x3b25a55f43294bcb }, { 0xdd15fe86affad912, 0x49ef0eb713f39ebe },
+	{ 0x8a2dbf142dfcc7ab, 0x6e3569326c784337 }, { 0xacb92ed9397bf996, 0x49c2c37f07965404 },
+	{ 0xd7e77a8f87daf7fb, 0xdc33745ec97be906 }, { 0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3 },
+	{ 0xa8acd7c0222311bc, 0xc40832ea0d68ce0c }, { 0xd2d80db02aabd62b, 0xf50a3fa490c30190 },
+	{ 0x83c7088e1aab65db, 0x792667c6da79e0fa }, { 0xa4b8cab1a1563f52, 0x577001b891185938 },
+	{ 0xcde6fd5e09abcf26, 0xed4c0226b55e6f86 }, { 0x80b05e5ac60b6178, 0x544f8158315b05b4 },
+	{ 0xa0dc75f1778e39d6, 0x696361ae3db1c721 }, { 0xc913936dd571c84c, 0x03bc3a19cd1e38e9 },
+	{ 0xfb5878494ace3a5f, 0x04ab48a04065c723 }, { 0x9d174b2dcec0e47b, 0x62eb0d64283f9c76 },
+	{ 0xc45d1df942711d9a, 0x3ba5d0bd324f8394 }, { 0xf5746577930d6500, 0xca8f44ec7ee36479 },
+	{ 0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb }, { 0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e },
+	{ 0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e }, { 0x95d04aee3b80ece5, 0xbba1f1d158724a12 },
+	{ 0xbb445da9ca61281f, 0x2a8a6e45ae8edc97 }, { 0xea1575143cf97226, 0xf52d09d71a3293bd },
+	{ 0x924d692ca61be758, 0x593c2626705f9c56 }, { 0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c },
+	{ 0xe498f455c38b997a, 0x0b6dfb9c0f956447 }, { 0x8edf98b59a373fec, 0x4724bd4189bd5eac },
+	{ 0xb2977ee300c50fe7, 0x58edec91ec2cb657 }, { 0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed },
+	{ 0x8b865b215899f46c, 0xbd79e0d20082ee74 }, { 0xae67f1e9aec07187, 0xecd8590680a3aa11 },
+	{ 0xda01ee641a708de9, 0xe80e6f4820cc9495 }, { 0x884134fe908658b2, 0x3109058d147fdcdd },
+	{ 0xaa51823e34a7eede, 0xbd4b46f0599fd415 }, { 0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a },
+	{ 0x850fadc09923329e, 0x03e2cf6bc604ddb0 }, { 0xa6539930bf6bff45, 0x84db8346b786151c },
+	{ 0xcfe87f7cef46ff16, 0xe612641865679a63 }, { 0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e },
+	{ 0xa26da3999aef7749, 0xe3be5e330f38f09d }, { 0xcb090c8001ab551c, 0x5cadf5bfd3072cc5 },
+	{ 0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6 }, { 0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa },
+	{ 0xc646d63501a1511d, 0xb281e1fd541501b8 }, { 0xf7d88bc24209a565, 0x1f225a7ca91a4226 },
+	{ 0x9ae757596946075f, 0x3375788de9b06958 }, { 0xc1a12d2fc3978937, 0x0052d6b1641c83ae },
+	{ 0xf209787bb47d6b84, 0xc0678c5dbd23a49a }, { 0x9745eb4d50ce6332, 0xf840b7ba963646e0 },
+	{ 0xbd176620a501fbff, 0xb650e5a93bc3d898 }, { 0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe },
+	{ 0x93ba47c980e98cdf, 0xc66f336c36b10137 }, { 0xb8a8d9bbe123f017, 0xb80b0047445d4184 },
+	{ 0xe6d3102ad96cec1d, 0xa60dc059157491e5 }, { 0x9043ea1ac7e41392, 0x87c89837ad68db2f },
+	{ 0xb454e4a179dd1877, 0x29babe4598c311fb }, { 0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a },
+	{ 0x8ce2529e2734bb1d, 0x1899e4a65f58660c }, { 0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f },
+	{ 0xdc21a1171d42645d, 0x76707543f4fa1f73 }, { 0x899504ae72497eba, 0x6a06494a791c53a8 },
+	{ 0xabfa45da0edbde69, 0x0487db9d17636892 }, { 0xd6f8d7509292d603, 0x45a9d2845d3c42b6 },
+	{ 0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2 }, { 0xa7f26836f282b732, 0x8e6cac7768d7141e },
+	{ 0xd1ef0244af2364ff, 0x3207d795430cd926 }, { 0x8335616aed761f1f, 0x7f44e6bd49e807b8 },
+	{ 0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6 }, { 0xcd036837130890a1, 0x36dba887c37a8c0f },
+	{ 0x802221226be55a64, 0xc2494954da2c9789 }, { 0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c },
+	{ 0xc83553c5c8965d3d, 0x6f92829494e5acc7 }, { 0xfa42a8b73abbf48c, 0xcb772339ba1f17f9 },
+	{ 0x9c69a97284b578d7, 0xff2a760414536efb }, { 0xc38413cf25e2d70d, 0xfef5138519684aba },
+	{ 0xf46518c2ef5b8cd1, 0x7eb258665fc25d69 }, { 0x98bf2f79d5993802, 0xef2f773ffbd97a61 },
+	{ 0xbeeefb584aff8603, 0xaafb550ffacfd8fa }, { 0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38 },
+	{ 0x952ab45cfa97a0b2, 0xdd945a747bf26183 }, { 0xba756174393d88df, 0x94f971119aeef9e4 },
+	{ 0xe912b9d1478ceb17, 0x7a37cd5601aab85d }, { 0x91abb422ccb812ee, 0xac62e055c10ab33a },
+	{ 0xb616a12b7fe617aa, 0x577b986b314d6009 }, { 0xe39c49765fdf9d94, 0xed5a7e85fda0b80b },
+	{ 0x8e41ade9fbebc27d, 0x14588f13be847307 }, { 0xb1d219647ae6b31c, 0x596eb2d8ae258fc8 },
+	{ 0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb }, { 0x8aec23d680043bee, 0x25de7bb9480d5854 },
+	{ 0xada72ccc20054ae9, 0xaf561aa79a10ae6a }, { 0xd910f7ff28069da4, 0x1b2ba1518094da04 },
+	{ 0x87aa9aff79042286, 0x90fb44d2f05d0842 }, { 0xa99541bf57452b28, 0x353a1607ac744a53 },
+	{ 0xd3fa922f2d1675f2, 0x42889b8997915ce8 }, { 0x847c9b5d7c2e09b7, 0x69956135febada11 },
+	{ 0xa59bc234db398c25, 0x43fab9837e699095 }, { 0xcf02b2c21207ef2e, 0x94f967e45e03f4bb },
+	{ 0x8161afb94b44f57d, 0x1d1be0eebac278f5 }, { 0xa1ba1ba79e1632dc, 0x6462d92a69731732 },
+	{ 0xca28a291859bbf93, 0x7d7b8f7503cfdcfe }, { 0xfcb2cb35e702af78, 0x5cda735244c3d43e },
+	{ 0x9defbf01b061adab, 0x3a0888136afa64a7 }, { 0xc56baec21c7a1916, 0x088aaa1845b8fdd0 },
+	{ 0xf6c69a72a3989f5b, 0x8aad549e57273d45 }, { 0x9a3c2087a63f6399, 0x36ac54e2f678864b },
+	{ 0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd }, { 0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5 },
+	{ 0x969eb7c47859e743, 0x9f644ae5a4b1b325 }, { 0xbc4665b596706114, 0x873d5d9f0dde1fee },
+	{ 0xeb57ff22fc0c7959, 0xa90cb506d155a7ea }, { 0x9316ff75dd87cbd8, 0x09a7f12442d588f2 },
+	{ 0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f }, { 0xe5d3ef282a242e81, 0x8f1668c8a86da5fa },
+	{ 0x8fa475791a569d10, 0xf96e017d694487bc }, { 0xb38d92d760ec4455, 0x37c981dcc395a9ac },
+	{ 0xe070f78d3927556a, 0x85bbe253f47b1417 }, { 0x8c469ab843b89562, 0x93956d7478ccec8e },
+	{ 0xaf58416654a6babb, 0x387ac8d1970027b2 }, { 0xdb2e51bfe9d0696a, 0x06997b05fcc0319e },
+	{ 0x88fcf317f22241e2, 0x441fece3bdf81f03 }, { 0xab3c2fddeeaad25a, 0xd527e81cad7626c3 },
+	{ 0xd60b3bd56a5586f1, 0x8a71e223d8d3b074 }, { 0x85c7056562757456, 0xf6872d5667844e49 },
+	{ 0xa738c6bebb12d16c, 0xb428f8ac016561db }, { 0xd106f86e69d785c7, 0xe13336d701beba52 },
+	{ 0x82a45b450226b39c, 0xecc0024661173473 }, { 0xa34d721642b06084, 0x27f002d7f95d0190 },
+	{ 0xcc20ce9bd35c78a5, 0x31ec038df7b441f4 }, { 0xff290242c83396ce, 0x7e67047175a15271 },
+	{ 0x9f79a169bd203e41, 0x0f0062c6e984d386 }, { 0xc75809c42c684dd1, 0x52c07b78a3e60868 },
+	{ 0xf92e0c3537826145, 0xa7709a56ccdf8a82 }, { 0x9bbcc7a142b17ccb, 0x88a66076400bb691 },
+	{ 0xc2abf989935ddbfe, 0x6acff893d00ea435 }, { 0xf356f7ebf83552fe, 0x0583f6b8c4124d43 },
+	{ 0x98165af37b2153de, 0xc3727a337a8b704a }, { 0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c },
+	{ 0xeda2ee1c7064130c, 0x1162def06f79df73 }, { 0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8 },
+	{ 0xb9a74a0637ce2ee1, 0x6d953e2bd7173692 }, { 0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437 },
+	{ 0x910ab1d4db9914a0, 0x1d9c9892400a22a2 }, { 0xb54d5e4a127f59c8, 0x2503beb6d00cab4b },
+	{ 0xe2a0b5dc971f303a, 0x2e44ae64840fd61d }, { 0x8da471a9de737e24, 0x5ceaecfed289e5d2 },
+	{ 0xb10d8e1456105dad, 0x7425a83e872c5f47 }, { 0xdd50f1996b947518, 0xd12f124e28f77719 },
+	{ 0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f }, { 0xace73cbfdc0bfb7b, 0x636cc64d1001550b },
+	{ 0xd8210befd30efa5a, 0x3c47f7e05401aa4e }, { 0x8714a775e3e95c78, 0x65acfaec34810a71 },
+	{ 0xa8d9d1535ce3b396, 0x7f1839a741a14d0d }, { 0xd31045a8341ca07c, 0x1ede48111209a050 },
+	{ 0x83ea2b892091e44d, 0x934aed0aab460432 }, { 0xa4e4b66b68b65d60, 0xf81da84d5617853f },
+	{ 0xce1de40642e3f4b9, 0x36251260ab9d668e }, { 0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019 },
+	{ 0xa1075a24e4421730, 0xb24cf65b8612f81f }, { 0xc94930ae1d529cfc, 0xdee033f26797b627 },
+	{ 0xfb9b7cd9a4a7443c, 0x169840ef017da3b1 }, { 0x9d412e0806e88aa5, 0x8e1f289560ee864e },
+	{ 0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2 }, { 0xf5b5d7ec8acb58a2, 0xae10af696774b1db },
+	{ 0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29 }, { 0xbff610b0cc6edd3f, 0x17fd090a58d32af3 },
+	{ 0xeff394dcff8a948e, 0xddfc4b4cef07f5b0 }, { 0x95f83d0a1fb69cd9, 0x4abdaf101564f98e },
+	{ 0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1 }, { 0xea53df5fd18d5513, 0x84c86189216dc5ed },
+	{ 0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4 }, { 0xb7118682dbb66a77, 0x3fbc8c33221dc2a1 },
+	{ 0xe4d5e82392a40515, 0x0fabaf3feaa5334a }, { 0x8f05b1163ba6832d, 0x29cb4d87f2a7400e },
+	{ 0xb2c71d5bca9023f8, 0x743e20e9ef511012 }, { 0xdf78e4b2bd342cf6, 0x914da9246b255416 },
+	{ 0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e }, { 0xae9672aba3d0c320, 0xa184ac2473b529b1 },
+	{ 0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e }, { 0x8865899617fb1871, 0x7e2fa67c7a658892 },
+	{ 0xaa7eebfb9df9de8d, 0xddbb901b98feeab7 }, { 0xd51ea6fa85785631, 0x552a74227f3ea565 },
+	{ 0x8533285c936b35de, 0xd53a88958f87275f }, { 0xa67ff273b8460356, 0x8a892abaf368f137 },
+	{ 0xd01fef10a657842c, 0x2d2b7569b0432d85 }, { 0x8213f56a67f6b29b, 0x9c3b29620e29fc73 },
+	{ 0xa298f2c501f45f42, 0x8349f3ba91b47b8f }, { 0xcb3f2f7642717713, 0x241c70a936219a73 },
+	{ 0xfe0efb53d30dd4d7, 0xed238cd383aa0110 }, { 0x9ec95d1463e8a506, 0xf4363804324a40aa },
+	{ 0xc67bb4597ce2ce48, 0xb143c6053edcd0d5 }, { 0xf81aa16fdc1b81da, 0xdd94b7868e94050a },
+	{ 0x9b10a4e5e9913128, 0xca7cf2b4191c8326 }, { 0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0 },
+	{ 0xf24a01a73cf2dccf, 0xbc633b39673c8cec }, { 0x976e41088617ca01, 0xd5be0503e085d813 },
+	{ 0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18 }, { 0xec9c459d51852ba2, 0xddf8e7d60ed1219e },
+	{ 0x93e1ab8252f33b45, 0xcabb90e5c942b503 }, { 0xb8da1662e7b00a17, 0x3d6a751f3b936243 },
+	{ 0xe7109bfba19c0c9d, 0x0cc512670a783ad4 }, { 0x906a617d450187e2, 0x27fb2b80668b24c5 },
+	{ 0xb484f9dc9641e9da, 0xb1f9f660802dedf6 }, { 0xe1a63853bbd26451, 0x5e7873f8a0396973 },
+	{ 0x8d07e33455637eb2, 0xdb0b487b6423e1e8 }, { 0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62 },
+	{ 0xdc5c5301c56b75f7, 0x7641a140cc7810fb }, { 0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d },
+	{ 0xac2820d9623bf429, 0x546345fa9fbdcd44 }, { 0xd732290fbacaf133, 0xa97c177947ad4095 },
+	{ 0x867f59a9d4bed6c0, 0x49ed8eabcccc485d }, { 0xa81f301449ee8c70, 0x5c68f256bfff5a74 },
+	{ 0xd226fc195c6a2f8c, 0x73832eec6fff3111 }, { 0x83585d8fd9c25db7, 0xc831fd53c5ff7eab },
+	{ 0xa42e74f3d032f525, 0xba3e7ca8b77f5e55 }, { 0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb },
+	{ 0x80444b5e7aa7cf85, 0x7980d163cf5b81b3 }, { 0xa0555e361951c366, 0xd7e105bcc332621f },
+	{ 0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7 }, { 0xfa856334878fc150, 0xb14f98f6f0feb951 },
+	{ 0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3 }, { 0xc3b8358109e84f07, 0x0a862f80ec4700c8 },
+	{ 0xf4a642e14c6262c8, 0xcd27bb612758c0fa }, { 0x98e7e9cccfbd7dbd, 0x8038d51cb897789c },
+	{ 0xbf21e44003acdd2c, 0xe0470a63e6bd56c3 }, { 0xeeea5d5004981478, 0x1858ccfce06cac74 },
+	{ 0x95527a5202df0ccb, 0x0f37801e0c43ebc8 }, { 0xbaa718e68396cffd, 0xd30560258f54e6ba },
+	{ 0xe950df20247c83fd, 0x47c6b82ef32a2069 }, { 0x91d28b7416cdd27e, 0x4cdc331d57fa5441 },
+	{ 0xb6472e511c81471d, 0xe0133fe4adf8e952 }, { 0xe3d8f9e563a198e5, 0x58180fddd97723a6 },
+	{ 0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648 },
+};
+
+/*
+ *	A decimal number `significand` * 10^`exponent` as written in the input, with at
+ *	most kDecimalParseMaxSignificantDigits significant digits kept in `significand`.
+ */
+typedef struct
+{
+	uint64_t	significand;
+	int64_t		exponent;
+	bool		isNegative;
+	bool		isTruncated;
+} DecimalNumber;
+
+static bool
+isDecimalDigit(char c)
+{
+	return (c >= '0') && (c <= '9');
+}
 
-	while (token)
+/*
+ *	Split a plain decimal number of the form accepted by `strtod` at the start of `str`
+ *	into its significand and exponent. Returns false if `str` does not start with one
+ *	(no digits, hexadecimal, infinity or NaN) or if the number is followed by a Ux
+ *	suffix, all of which are left to `strtod`/`strtof`.
+ */
+static bool
+splitDecimalNumber(const char *  str, DecimalNumber *  number)
+{
+	const char *	p = str;
+	uint64_t	significand = 0;
+	int64_t		exponent = 0;
+	int		significantDigits = 0;
+	bool		isNegative = false;
+	bool		isTruncated = false;
+	bool		hasDigits = false;
+
+	while (safeIsspace(*p))
 	{
-		if (columnCount == numberOfExpectedHeaders)
-		{
-			fprintf(stderr, "Error: The input CSV data has more than expected header values\n");
+		p++;
+	}
 
-			return kCommonConstantReturnTypeError;
-		}
+	if ((*p == '+') || (*p == '-'))
+	{
+		isNegative = (*p == '-');
+		p++;
+	}
 
-		assert(expectedHeaders[columnCount] != NULL);
+	if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X')))
+	{
+		return false;
+	}
 
-		size_t	expectedHeaderLength = strlen(expectedHeaders[columnCount]);
+	for (; isDecimalDigit(*p); p++)
+	{
+		int	digit = *p - '0';
 
-		/*
-		 *	Trim leading whitespace
-		 */
-		while(safeIsspace(*token))
+		hasDigits = true;
+		if (significantDigits < kDecimalParseMaxSignificantDigits)
 		{
-			token++;
+			significand = significand * 10 + (uint64_t)digit;
+			significantDigits += (significand != 0);
+		}
+		else
+		{
+			exponent++;
+			isTruncated |= (digit != 0);
 		}
+	}
 
-		/*
-		 *	Validate that the token starts with the expected header.
-		 */
-		if(strncmp(token, expectedHeaders[columnCount], expectedHeaderLength) != 0)
+	if (*p == '.')
+	{
+		for (p++; isDecimalDigit(*p); p++)
 		{
-			fprintf(
-				stderr,
-				"Error: Column %zu of the input CSV should have header '%s' but has header '%s'\n",
-				columnCount,
-				expectedHeaders[columnCount],
-				token);
+			int	digit = *p - '0';
 
-			return kCommonConstantReturnTypeError;
+			hasDigits = true;
+			if (significantDigits < kDecimalParseMaxSignificantDigits)
+			{
+				significand = significand * 10 + (uint64_t)digit;
+				significantDigits += (significand != 0);
+				exponent--;
+			}
+			else
+			{
+				isTruncated |= (digit != 0);
+			}
 		}
+	}
 
-		/*
-		 *	Validate that the token ends with only whitespace (no more text)
-		 */
+	if (!hasDigits)
+	{
+		return false;
+	}
+
+	/*
+	 *	As with `strtod`, an exponent marker without digits is not part of the number.
+	 */
+	if ((*p == 'e') || (*p == 'E'))
+	{
+		const char *	q = p + 1;
+		int64_t		explicitExponent = 0;
+		bool		isExponentNegative = false;
+
+		if ((*q == '+') || (*q == '-'))
 		{
-			size_t	tokenLength = strlen(token);
-			size_t	tokenSuffixIndex = expectedHeaderLength;
+			isExponentNegative = (*q == '-');
+			q++;
+		}
 
-			for (size_t i = tokenSuffixIndex; i < tokenLength; ++i)
+		if (isDecimalDigit(*q))
+		{
+			for (; isDecimalDigit(*q); q++)
 			{
-				/*
-				 *	Check that this suffix character is whitespace.
-				 */
-				if (!safeIsspace(token[i]))
+				if (explicitExponent < kDecimalParseMaxExponentMagnitude)
 				{
-					fprintf(
-						stderr,
-						"Error: Column %zu of the input CSV should have header '%s' but has header '%s' (trailing characters)\n",
-						columnCount,
-						expectedHeaders[columnCount],
-						token);
-
-					return kCommonConstantReturnTypeError;
+					explicitExponent = explicitExponent * 10 + (*q - '0');
 				}
 			}
-		}
 
-		token = strtok_r(NULL, ",", &strtokState);
-		columnCount++;
+			exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+			p = q;
+		}
 	}
 
-	if (columnCount != numberOfExpectedHeaders)
+	if ((p[0] == 'U') && (p[1] == 'x'))
 	{
-		fprintf(stderr, "Error: The input CSV data has less than expected header values\n");
-
-		return kCommonConstantReturnTypeError;
+		return false;
 	}
 
-	return kCommonConstantReturnTypeSuccess;
+	*number = (DecimalNumber) {
+		.significand = significand,
+		.exponent = exponent,
+		.isNegative = isNegative,
+		.isTruncated = isTruncated,
+	};
+
+	return true;
 }
 
-CommonConstantReturnType
-readInputFloatDistributionsFromCSV(
-	const char *			inputFilePath,
-	const char * const *		expectedHeaders,
-	float *				inputDistributions,
-	size_t				numberOfDistributions)
-{
-	return readInputDistributionsFromCSV(
-						inputFilePath,
-						expectedHeaders,
-						(void * ) inputDistributions,
-						kFloatingPointVariableTypeFloat,
-						numberOfDistributions);
-}
-
-CommonConstantReturnType
-readInputDoubleDistributionsFromCSV(
-	const char *			inputFilePath,
-	const char * const *		expectedHeaders,
-	double *			inputDistributions,
-	size_t				numberOfDistributions)
+/*
+ *	Full 64 x 64 -> 128 bit product.
+ */
+static void
+multiply64To128(uint64_t a, uint64_t b, uint64_t *  high, uint64_t *  low)
 {
-	return readInputDistributionsFromCSV(
-						inputFilePath,
-						expectedHeaders,
-						(void * ) inputDistributions,
-						kFloatingPointVariableTypeDouble,
-						numberOfDistributions);
+#ifdef __SIZEOF_INT128__
+	__uint128_t	product = (__uint128_t)a * b;
+
+	*high = (uint64_t)(product >> 64);
+	*low = (uint64_t)product;
+#else
+	uint64_t	aLow = (uint32_t)a;
+	uint64_t	aHigh = a >> 32;
+	uint64_t	bLow = (uint32_t)b;
+	uint64_t	bHigh = b >> 32;
+	uint64_t	lowLow = aLow * bLow;
+	uint64_t	highLow = aHigh * bLow;
+	uint64_t	lowHigh = aLow * bHigh;
+	uint64_t	highHigh = aHigh * bHigh;
+	uint64_t	middle = (lowLow >> 32) + (uint32_t)highLow + lowHigh;
+
+	*high = highHigh + (highLow >> 32) + (middle >> 32);
+	*low = (middle << 32) | (uint32_t)lowLow;
+#endif
 }
 
-static CommonConstantReturnType
-readInputDistributionsFromCSV(
-	const char *			inputFilePath,
-	const char * const *		expectedHeaders,
-	void *				inputDistributions,
-	FloatingPointVariableType	inputDistributionsType,
-	size_t				numberOfDistributions)
+/*
+ *	Eisel-Lemire: compute the IEEE-754 bits (without sign) nearest to
+ *	`significand` * 10^`exponent` for a binary format with `mantissaBits` explicit
+ *	mantissa bits, the given exponent bias and all-ones (infinite) exponent. Returns
+ *	false if the result would be subnormal, zero, or overflow, leaving those (and
+ *	their `ERANGE` reporting) to libc.
+ */
+static bool
+eiselLemire(
+	uint64_t	significand,
+	int64_t		exponent,
+	int		mantissaBits,
+	int		exponentBias,
+	int64_t		infiniteExponent,
+	int		minimumRoundToEvenExponent,
+	int		maximumRoundToEvenExponent,
+	uint64_t *	bits)
 {
-	if (numberOfDistributions == 0)
+	const uint64_t *	powerOfFive;
+	uint64_t		precisionMask = UINT64_MAX >> (mantissaBits + 3);
+	uint64_t		productHigh;
+	uint64_t		productLow;
+	uint64_t		mantissa;
+	int64_t			binaryExponent;
+	int			leadingZeros;
+	int			upperBit;
+	int			shift;
+
+	if ((significand == 0) || (exponent < kDecimalParseSmallestPowerOfTen) || (exponent > kDecimalParseLargestPowerOfTen))
 	{
-		return kCommonConstantReturnTypeSuccess;
+		return false;
 	}
 
-	assert(inputFilePath);
-	assert(inputDistributions);
-	assert(expectedHeaders);
+	leadingZeros = __builtin_clzll(significand);
+	significand <<= leadingZeros;
 
-	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
-	float **			inputFloatSampleValues = NULL;
-	double **			inputDoubleSampleValues = NULL;
-	float *				inputFloatDistributions = NULL;
-	double *			inputDoubleDistributions = NULL;
-	char *				buffer = NULL;
-	char *				token;
-	char *				strtokState;
-	int64_t				rowCount = -1;
-	size_t				columnCount;
-	size_t *			sampleCounts = NULL;
-	bool *				uxColumns = NULL;
-	FILE *				fp = NULL;
-	float				parsedFloatValue;
-	double				parsedDoubleValue;
+	powerOfFive = powersOfFive128[exponent - kDecimalParseSmallestPowerOfTen];
+	multiply64To128(significand, powerOfFive[0], &productHigh, &productLow);
 
-	switch (inputDistributionsType)
+	/*
+	 *	Only when the bits below the ones we keep are all set can the low half of the
+	 *	power of five change the result.
+	 */
+	if ((productHigh & precisionMask) == precisionMask)
 	{
-		case kFloatingPointVariableTypeFloat:
-		{
-			inputFloatDistributions = (float *) inputDistributions;
-
-			inputFloatSampleValues = (float **)checkedCalloc(numberOfDistributions, sizeof(double *), __FILE__, __LINE__);
-			for (size_t i = 0; i < numberOfDistributions; i++)
-			{
-				inputFloatSampleValues[i] = (float *)checkedCalloc(kCommonConstantMaxNumberOfInputSamples, sizeof(float), __FILE__, __LINE__);
-			}
-			break;
-		}
-		case kFloatingPointVariableTypeDouble:
-		{
-			inputDoubleDistributions = (double *) inputDistributions;
+		uint64_t	secondHigh;
+		uint64_t	secondLow;
 
-			inputDoubleSampleValues = (double **)checkedCalloc(numberOfDistributions, sizeof(double *), __FILE__, __LINE__);
-			for (size_t i = 0; i < numberOfDistributions; i++)
-			{
-				inputDoubleSampleValues[i] = (double *)checkedCalloc(kCommonConstantMaxNumberOfInputSamples, sizeof(double), __FILE__, __LINE__);
-			}
-			break;
-		}
-		case kFloatingPointVariableTypeUnknown:
-		default:
+		multiply64To128(significand, powerOfFive[1], &secondHigh, &secondLow);
+		productLow += secondHigh;
+		if (secondHigh > productLow)
 		{
-			fatal("inputDistributionsType must be specified");
+			productHigh++;
 		}
 	}
 
-	buffer = (char *)checkedCalloc(kCommonConstantMaxCharsPerLine, sizeof(char), __FILE__, __LINE__);
-	uxColumns = (bool *)checkedCalloc(numberOfDistributions, sizeof(bool), __FILE__, __LINE__);
-	sampleCounts = (size_t *)checkedCalloc(numberOfDistributions, sizeof(size_t), __FILE__, __LINE__);
+	upperBit = (int)(productHigh >> 63);
+	shift = upperBit + 64 - mantissaBits - 3;
+	mantissa = productHigh >> shift;
 
-	if (strcmp(inputFilePath, "stdin"))
-	{
-		fp = fopen(inputFilePath, "r");
+	/*
+	 *	floor(log2(10^exponent)) + 63, then rebias.
+	 */
+	binaryExponent = (((152170 + 65536) * exponent) >> 16) + 63 + upperBit - leadingZeros + exponentBias;
 
-		if (fp == NULL)
-		{
-			fprintf(stderr, "Error: Cannot open the file %s.\n", inputFilePath);
-			returnCode = kCommonConstantReturnTypeError;
-			goto cleanup;
-		}
-	}
-	else
+	if (binaryExponent <= 0)
 	{
-		/*
-		 *	Pipeline not supported
-		 */
-		fprintf(
-			stderr,
-			"Error: Pipeline mode not implemented. "
-			"Please use the '-i' command-line argument option.\n");
-
-		returnCode = kCommonConstantReturnTypeError;
-		goto cleanup;
+		return false;
 	}
 
 	/*
-	 *	Read the lines into buffer.
+	 *	Exactly halfway between two floating-point values: round to even.
 	 */
-	while (fgets(buffer, kCommonConstantMaxCharsPerLine, fp))
+	if ((productLow <= 1) && (exponent >= minimumRoundToEvenExponent) && (exponent <= maximumRoundToEvenExponent) &&
+		((mantissa & 3) == 1) && ((mantissa << shift) == productHigh))
 	{
-		/*
-		 *	Validate the row containing field/column names.
-		 */
-		if (rowCount == -1)
-		{
-			if (validateInputDistributionCSVHeader(buffer, expectedHeaders, numberOfDistributions) != 0)
-			{
-				returnCode = kCommonConstantReturnTypeError;
-				goto cleanup;
-			}
-
-			rowCount++;
-			continue;
-		}
-		else if (rowCount >= kCommonConstantMaxNumberOfInputSamples)
-		{
-			fprintf(
-				stderr,
-				"Error: The input CSV file has too many rows (the maximum is %" PRId64 ").\n",
-				rowCount);
-
-			returnCode = kCommonConstantReturnTypeError;
-			goto cleanup;
-		}
+		mantissa &= ~(uint64_t)1;
+	}
 
-		columnCount = 0;
+	mantissa += (mantissa & 1);
+	mantissa >>= 1;
+	if (mantissa >= ((uint64_t)2 << mantissaBits))
+	{
+		mantissa = (uint64_t)1 << mantissaBits;
+		binaryExponent++;
+	}
+	mantissa &= ~((uint64_t)1 << mantissaBits);
 
-		token = strtok_r(buffer, ",", &strtokState);
+	if (binaryExponent >= infiniteExponent)
+	{
+		return false;
+	}
 
-		while (token)
-		{
-			/*
-			 *	Trim leading whitespace
-			 */
-			while (safeIsspace((unsigned char)*token))
-			{
-				token++;
-			}
+	*bits = mantissa | ((uint64_t)binaryExponent << mantissaBits);
 
-			if (columnCount == numberOfDistributions)
-			{
-				fprintf(stderr,
-					"Error: The input CSV data has more than the expected entries "
-					"at data row %" PRIi64 ".\n",
-					rowCount);
+	return true;
+}
 
-				returnCode = kCommonConstantReturnTypeError;
-				goto cleanup;
-			}
+/*
+ *	Exactly representable powers of ten for the Clinger fast path.
+ */
+static const double	exactPowersOfTenDouble[] = {
+	1e0,	1e1,	1e2,	1e3,	1e4,	1e5,	1e6,	1e7,	1e8,	1e9,	1e10,	1e11,
+	1e12,	1e13,	1e14,	1e15,	1e16,	1e17,	1e18,	1e19,	1e20,	1e21,	1e22,
+};
 
-			/*
-			 *	Only parse this value if this is not a Ux value column.
-			 */
-			if (!uxColumns[columnCount])
-			{
-				if ((rowCount == 0) && (strstr(token, "Ux") != NULL))
-				{
-					uxColumns[columnCount] = true;
-				}
+static const float	exactPowersOfTenFloat[] = {
+	1e0f,	1e1f,	1e2f,	1e3f,	1e4f,	1e5f,	1e6f,	1e7f,	1e8f,	1e9f,	1e10f,
+};
 
-				bool	shouldIgnore = false;
+static bool
+decimalNumberToDouble(const DecimalNumber *  number, double *  out)
+{
+	uint64_t	bits;
+	uint64_t	bitsRoundedUp;
 
-				if (token[0] == '-')
-				{
-					for (size_t i = 1; true; i++)
-					{
-						if (token[i] == '\0')
-						{
-							shouldIgnore = true;
-							break;
-						}
-						if (!safeIsspace(token[i]))
-						{
-							break;
-						}
-					}
-				}
+	if (number->significand == 0)
+	{
+		*out = number->isNegative ? -0.0 : 0.0;
 
-				if (inputDistributionsType == kFloatingPointVariableTypeFloat)
-				{
-					if (shouldIgnore)
-					{
-						/*
-						 *	Ignore this entry
-						 */
-						inputFloatSampleValues[columnCount][sampleCounts[columnCount]] = 0.0;
-					}
-					else if (parseFloatChecked(token, &parsedFloatValue) != kCommonConstantReturnTypeSuccess)
-					{
-						fprintf(stderr,
-							"Error: The input CSV data at row %" PRId64 " and column %zu is not a valid number (was '%s').\n",
-							rowCount,
-							columnCount,
-							token);
-
-						returnCode = kCommonConstantReturnTypeError;
-						goto cleanup;
-					}
-					else
-					{
-						inputFloatSampleValues[columnCount][sampleCounts[columnCount]] = parsedFloatValue;
-						sampleCounts[columnCount]++;
-					}
-				}
-				else
-				{
-					if (shouldIgnore)
-					{
-						/*
-						 *	Ignore this entry
-						 */
-						inputDoubleSampleValues[columnCount][sampleCounts[columnCount]] = 0.0;
-					}
-					else if (parseDoubleChecked(token, &parsedDoubleValue) != kCommonConstantReturnTypeSuccess)
-					{
-						fprintf(stderr,
-							"Error: The input CSV data at row %" PRId64 " and column %zu is not a valid number (was '%s').\n",
-							rowCount,
-							columnCount,
-							token);
-
-						returnCode = kCommonConstantReturnTypeError;
-						goto cleanup;
-					}
-					else
-					{
-						inputDoubleSampleValues[columnCount][sampleCounts[columnCount]] = parsedDoubleValue;
-						sampleCounts[columnCount]++;
-					}
-				}
-			}
+		return true;
+	}
 
-			token = strtok_r(NULL, ",", &strtokState);
-			columnCount++;
-		}
+#if (FLT_EVAL_METHOD == 0)
+	/*
+	 *	Both operands are exact, so a single IEEE operation rounds correctly.
+	 */
+	if (!number->isTruncated && (number->significand <= ((uint64_t)1 << 53)) && (number->exponent >= -22) && (number->exponent <= 22))
+	{
+		double	value = (double)number->significand;
 
-		if (columnCount != numberOfDistributions)
-		{
-			fprintf(stderr,
-				"Error: The input CSV data has less than expected entries at data "
-				"row %" PRId64 ".\n",
-				rowCount);
 
-			return kCommonConstantReturnTypeError;
-		}
+		value = (number->exponent < 0)
+			? value / exactPowersOfTenDouble[-number->exponent]
+			: value * exactPowersOfTenDouble[number->exponent];
+		*out = number->isNegative ? -value : value;
 
-		rowCount++;
+		return true;
 	}
+#endif
 
-	if (fp != stdin)
+	if (!eiselLemire(number->significand, number->exponent, 52, 1023, 0x7FF, -4, 23, &bits))
 	{
-		fclose(fp);
+		return false;
 	}
 
 	/*
-	 *	Get distributions from collected sample values.
+	 *	Digits beyond the ones kept can only matter if rounding the next larger
+	 *	significand gives a different result.
 	 */
-	if (inputDistributionsType == kFloatingPointVariableTypeFloat)
-	{
-		for (size_t i = 0; i < numberOfDistributions; i++)
-		{
-			if (uxColumns[i])
-			{
-				inputFloatDistributions[i] = inputFloatSampleValues[i][0];
-			}
-			else
-			{
-				inputFloatDistributions[i] = UxHwFloatDistFromSamples(inputFloatSampleValues[i], sampleCounts[i]);
-			}
-		}
-	}
-	else
+	if (number->isTruncated &&
+		(!eiselLemire(number->significand + 1, number->exponent, 52, 1023, 0x7FF, -4, 23, &bitsRoundedUp) || (bits != bitsRoundedUp)))
 	{
-		for (size_t i = 0; i < numberOfDistributions; i++)
-		{
-			if (uxColumns[i])
-			{
-				inputDoubleDistributions[i] = inputDoubleSampleValues[i][0];
-			}
-			else
-			{
-				inputDoubleDistributions[i] = UxHwDoubleDistFromSamples(inputDoubleSampleValues[i], sampleCounts[i]);
-			}
-		}
+		return false;
 	}
 
-	returnCode = kCommonConstantReturnTypeSuccess;
+	bits |= (uint64_t)number->isNegative << 63;
+	memcpy(out, &bits, sizeof(*out));
 
-cleanup:
+	return true;
+}
 
-	free(buffer);
+static bool
+decimalNumberToFloat(const DecimalNumber *  number, float *  out)
+{
+	uint64_t	bits;
+	uint64_t	bitsRoundedUp;
+	uint32_t	floatBits;
 
-	if (inputFloatSampleValues != NULL)
+	if (number->significand == 0)
 	{
-		for (size_t i = 0; i < numberOfDistributions; i++)
-		{
-			free(inputFloatSampleValues[i]);
-		}
+		*out = number->isNegative ? -0.0f : 0.0f;
 
-		free(inputFloatSampleValues);
+		return true;
 	}
 
-	if (inputDoubleSampleValues != NULL)
+#if (FLT_EVAL_METHOD == 0)
+	if (!number->isTruncated && (number->significand <= ((uint64_t)1 << 24)) && (number->exponent >= -10) && (number->exponent <= 10))
 	{
-		for (size_t i = 0; i < numberOfDistributions; i++)
-		{
-			free(inputDoubleSampleValues[i]);
-		}
+		float	value = (float)number->significand;
+
 
-		free(inputDoubleSampleValues);
+		value = (number->exponent < 0)
+			? value / exactPowersOfTenFloat[-number->exponent]
+			: value * exactPowersOfTenFloat[number->exponent];
+		*out = number->isNegative ? -value : value;
+
+		return true;
 	}
-	free(sampleCounts);
-	free(uxColumns);
+#endif
 
-	return returnCode;
-}
+	if (!eiselLemire(number->significand, number->exponent, 23, 127, 0xFF, -17, 10, &bits))
+	{
+		return false;
+	}
 
-CommonConstantReturnType
-writeOutputFloatDistributionsToCSV(
-	const char *		outputFilePath,
-	const float *		outputVariables,
-	const char * const *	outputVariableNames,
-	size_t			numberOfOutputDistributions)
-{
-	return writeOutputDistributionsToCSV(
-						outputFilePath,
-						(const void *) outputVariables,
-						kFloatingPointVariableTypeFloat,
-						outputVariableNames,
-						numberOfOutputDistributions);
+	if (number->isTruncated &&
+		(!eiselLemire(number->significand + 1, number->exponent, 23, 127, 0xFF, -17, 10, &bitsRoundedUp) || (bits != bitsRoundedUp)))
+	{
+		return false;
+	}
+
+	floatBits = (uint32_t)bits | ((uint32_t)number->isNegative << 31);
+	memcpy(out, &floatBits, sizeof(*out));
+
+	return true;
 }
 
 CommonConstantReturnType
-writeOutputDoubleDistributionsToCSV(
-	const char *		outputFilePath,
-	const double *		outputVariables,
-	const char * const *	outputVariableNames,
-	size_t			numberOfOutputDistributions)
+parseFloatFast(const char *  str, float *  out)
 {
-	return writeOutputDistributionsToCSV(
-						outputFilePath,
-						(const void *) outputVariables,
-						kFloatingPointVariableTypeDouble,
-						outputVariableNames,
-						numberOfOutputDistributions);
+	assert(str != NULL);
+	assert(out != NULL);
+
+	DecimalNumber	number;
+
+	if (splitDecimalNumber(str, &number) && decimalNumberToFloat(&number, out))
+	{
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	/*
+	 *	Anything the fast path cannot decide exactly, including every error, is
+	 *	decided by `strtof`.
+	 */
+	return parseFloatChecked(str, out);
 }
 
 CommonConstantReturnType
-writeOutputDistributionsToCSV(
-	const char *			outputFilePath,
-	const void *			outputVariables,
-	FloatingPointVariableType	outputVariablesType,
-	const char * const *		outputVariableNames,
-	size_t				numberOfOutputDistributions)
+parseDoubleFast(const char *  str, double *  out)
 {
-	FILE *		fp = NULL;
-	float *		outputFloatVariables;
-	double *	outputDoubleVariables;
-
-	if (strcmp(outputFilePath, "stdout"))
-	{
-		fp = fopen(outputFilePath, "w");
+	assert(str != NULL);
+	assert(out != NULL);
 
-		if (fp == NULL)
-		{
-			fprintf(stderr, "Error: Cannot open the file %s.\n", outputFilePath);
+	DecimalNumber	number;
 
-			return kCommonConstantReturnTypeError;
-		}
-	}
-	else
+	if (splitDecimalNumber(str, &number) && decimalNumberToDouble(&number, out))
 	{
-		fp = stdout;
+		return kCommonConstantReturnTypeSuccess;
 	}
 
-	for (size_t i = 0; i < numberOfOutputDistributions; i++)
-	{
-		fprintf(fp, "%s", outputVariableNames[i]);
-		if (i != numberOfOutputDistributions - 1)
-		{
-			fprintf(fp, ", ");
-		}
-	}
-	fprintf(fp, "\n");
+	/*
+	 *	Anything the fast path cannot decide exactly, including every error, is
+	 *	decided by `strtod`.
+	 */
+	return parseDoubleChecked(str, out);
+}
 
-	switch (outputVariablesType)
+/*
+ *	Contents of an input file, either mapped read-only into memory or read into a
+ *	NUL-terminated heap buffer.
+ */
+typedef struct
+{
+	const char *	data;
+	size_t		size;
+	bool		isMapped;
+} InputFileBuffer;
+
+#ifdef COMMON_HAVE_MMAP
+/*
+ *	Map `inputFilePath` read-only into memory. Fails (and leaves nothing to clean up)
+ *	whenever the caller should fall back to stdio instead, for example because the
+ *	file is a pipe or a FIFO.
+ */
+static CommonConstantReturnType
+mapInputFileBuffer(const char *  inputFilePath, InputFileBuffer *  input)
+{
+	struct stat	fileStatus;
+	void *		mapping = MAP_FAILED;
+	int		fd = open(inputFilePath, O_RDONLY);
+
+	if (fd < 0)
 	{
-		case kFloatingPointVariableTypeFloat:
-		{
-			outputFloatVariables = (float *) outputVariables;
+		return kCommonConstantReturnTypeError;
+	}
 
-			for (size_t i = 0; i < numberOfOutputDistributions; i++)
-			{
-				fprintf(fp, "%e", outputFloatVariables[i]);
-				if (i != numberOfOutputDistributions - 1)
-				{
-					fprintf(fp, ", ");
-				}
-			}
-			break;
-		}
-		case kFloatingPointVariableTypeDouble:
-		{
-			outputDoubleVariables = (double *) outputVariables;
+	if ((fstat(fd, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode) || (fileStatus.st_size <= 0))
+	{
+		close(fd);
 
-			for (size_t i = 0; i < numberOfOutputDistributions; i++)
-			{
-				fprintf(fp, "%le", outputDoubleVariables[i]);
-				if (i != numberOfOutputDistributions - 1)
-				{
-					fprintf(fp, ", ");
-				}
-			}
-			break;
-		}
-		case kFloatingPointVariableTypeUnknown:
-		default:
-		{
-			fatal("outputVariablesType must be specified");
-		}
+		return kCommonConstantReturnTypeError;
 	}
-	fprintf(fp, "\n");
 
-	if (fp != stdout)
+	mapping = mmap(NULL, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (mapping == MAP_FAILED)
 	{
-		fclose(fp);
+		return kCommonConstantReturnTypeError;
 	}
 
+	posix_madvise(mapping, (size_t)fileStatus.st_size, POSIX_MADV_SEQUENTIAL);
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesRead, (uint64_t)fileStatus.st_size);
+
+	*input = (InputFileBuffer) {
+		.data = (const char *)mapping,
+		.size = (size_t)fileStatus.st_size,
+		.isMapped = true,
+	};
+
 	return kCommonConstantReturnTypeSuccess;
 }
 
-void
-printJSONVariables(JSONVariable *  jsonVariables, size_t count, const char *  description)
+/*
+ *	Map the CSV file `inputFilePath` so that it can be parsed in place. The byte
+ *	following every field of the mapping is one of ',', '\n' or '\0', so number
+ *	parsing can run directly over it.
+ */
+static CommonConstantReturnType
+mapCSVInputBuffer(const char *  inputFilePath, InputFileBuffer *  input)
 {
+	long	pageSize = sysconf(_SC_PAGESIZE);
+
+	if ((pageSize <= 0) || (mapInputFileBuffer(inputFilePath, input) != kCommonConstantReturnTypeSuccess))
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
 	/*
-	 *	Print JSON outputs.
+	 *	The zero-filled tail of the last page terminates the final field, unless the
+	 *	file exactly fills its last page. In that case the final byte must be a
+	 *	newline, otherwise parsing the final field could read past the mapping.
 	 */
-	printf("{\n");
-	printf("\t\"description\": \"%s\",\n", description);
-	printf("\t\"plots\": [\n");
+	if (((input->size % (size_t)pageSize) == 0) && (input->data[input->size - 1] != '\n'))
+	{
+		munmap((void *)input->data, input->size);
+		input->data = NULL;
 
-	for (size_t i = 0; i < count; i++)
+		return kCommonConstantReturnTypeError;
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+#endif /* COMMON_HAVE_MMAP */
+
+/*
+ *	Read the whole of `inputFilePath` into a NUL-terminated heap buffer.
+ */
+static CommonConstantReturnType
+readInputFileBuffer(const char *  inputFilePath, InputFileBuffer *  input)
+{
+	size_t	capacity = 64 * 1024;
+	size_t	size = 0;
+	char *	data;
+	FILE *	fp = fopen(inputFilePath, "rb");
+
+	if (fp == NULL)
 	{
-		printf("\t\t{\n");
+		return kCommonConstantReturnTypeError;
+	}
 
-		/*
-		 *	We include this property in the JSON for backwards compatibility.
-		 */
-		printf("\t\t\t\"variableID\": \"%s\",\n", jsonVariables[i].variableSymbol);
-		printf("\t\t\t\"variableSymbol\": \"%s\",\n", jsonVariables[i].variableSymbol);
-		printf("\t\t\t\"variableDescription\": \"%s\",\n", jsonVariables[i].variableDescription);
-		printf("\t\t\t\"values\": [\n");
-		for (size_t j = 0; j < jsonVariables[i].size; j++)
+	data = (char *)checkedMalloc(capacity, __FILE__, __LINE__);
+	for (;;)
+	{
+		size_t	bytesRead;
+
+		if (capacity - size < 2)
 		{
-			switch (jsonVariables[i].type)
-			{
-				case kJSONVariableTypeDouble:
-				{
-					printf("\t\t\t\t\"%f\"", jsonVariables[i].values.asDouble[j]);
-					break;
-				}
-				case kJSONVariableTypeFloat:
-				{
-					printf("\t\t\t\t\"%f\"", jsonVariables[i].values.asFloat[j]);
-					break;
-				}
-				case kJSONVariableTypeDoubleParticle:
-				{
-					printf("\t\t\t\t\"% " SignaloidParticleModifier "f\"", jsonVariables[i].values.asDouble[j]);
-					break;
-				}
-				case kJSONVariableTypeFloatParticle:
-				{
-					printf("\t\t\t\t\"% " SignaloidParticleModifier "f\"", jsonVariables[i].values.asFloat[j]);
-					break;
-				}
-				case kJSONVariableTypeUnknown:
-				default:
-				{
-					fatal("kJSONVariableTypeUnknown must be specified");
-				}
+			char *	grown;
 
-			}
-			if (j < (jsonVariables[i].size - 1))
-			{
-				printf(", \n");
-			}
-			else
+			capacity *= 2;
+			grown = (char *)realloc(data, capacity);
+			if (grown == NULL)
 			{
-				printf("\n");
+				fatal("realloc() failed to allocate %zu bytes at %s:%d", capacity, __FILE__, __LINE__);
 			}
+			data = grown;
 		}
-		printf("\t\t\t],\n");
 
-		printf("\t\t\t\"stdValues\": [\n");
-		for (size_t j = 0; j < jsonVariables[i].size; j++)
+		bytesRead = fread(data + size, 1, capacity - size - 1, fp);
+		size += bytesRead;
+		COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesRead, bytesRead);
+		if (bytesRead == 0)
 		{
-			switch (jsonVariables[i].type)
-			{
-				case kJSONVariableTypeDouble:
-				{
-					printf(
-						"\t\t\t\t% " SignaloidParticleModifier "f",
-						UxHwDoubleNthMoment(jsonVariables[i].values.asDouble[j], 2));
-					break;
-				}
-				case kJSONVariableTypeFloat:
-				{
-					printf(
-						"\t\t\t\t% " SignaloidParticleModifier "f",
-						UxHwFloatNthMoment(jsonVariables[i].values.asFloat[j], 2));
-					break;
-				}
-				case kJSONVariableTypeFloatParticle:
-				case kJSONVariableTypeDoubleParticle:
-				{
-					printf("\t\t\t\t% " SignaloidParticleModifier "f", 0.0);
-					break;
-				}
-				case kJSONVariableTypeUnknown:
-				default:
-				{
-					fatal("kJSONvariableTypeUnknown must be specified");
-				}
-			}
-			if (j < (jsonVariables[i].size - 1))
-			{
-				printf(", \n");
-			}
-			else
-			{
-				printf("\n");
-			}
+			break;
 		}
-		printf("\t\t\t]\n");
+	}
 
-		printf("\t\t}");
-		if (i < count - 1)
-		{
-			printf(",");
-		}
-		printf("\n");
+	if (ferror(fp))
+	{
+		fclose(fp);
+		free(data);
+
+		return kCommonConstantReturnTypeError;
 	}
+	fclose(fp);
+
+	data[size] = '\0';
+
+	*input = (InputFileBuffer) {
+		.data = data,
+		.size = size,
+		.isMapped = false,
+	};
 
-	printf("\t]\n");
-	printf("}\n");
+	return kCommonConstantReturnTypeSuccess;
 }
 
 static void
-setDefaultCommandLineArgumentValues(CommonCommandLineArguments *  arguments)
+closeInputFileBuffer(InputFileBuffer *  input)
 {
-	assert(arguments != NULL);
+	if (input->data == NULL)
+	{
+		return;
+	}
 
-	*arguments = (CommonCommandLineArguments) {
-							.outputFilePath			= "",
-							.inputFilePath			= "",
-							.isWriteToFileEnabled		= false,
-							.isTimingEnabled		= false,
-							.numberOfMonteCarloIterations	= 1,
-							.outputSelect			= 0,
-							.isOutputSelected		= false,
-							.isVerbose			= false,
-							.isInputFromFileEnabled		= false,
-							.isOutputJSONMode		= false,
-							.isHelpEnabled			= false,
-							.isBenchmarkingMode		= false,
-							.isMonteCarloMode		= false,
-							.isSingleShotExecution		= true,
-						};
+#ifdef COMMON_HAVE_MMAP
+	if (input->isMapped)
+	{
+		munmap((void *)input->data, input->size);
+		input->data = NULL;
 
-}
+		return;
+	}
+#endif /* COMMON_HAVE_MMAP */
 
-static bool
-getOptIsNewlib(void)
-{
-#ifdef _NEWLIB_VERSION
-	return true;
-#endif
-#ifdef MOCK_NEWLIB_VERSION
-	return true;
-#endif
-	return false;
+	free((void *)input->data);
+	input->data = NULL;
 }
 
 /*
- *	In every other POSIX libc `getopt_long_only` parses long options starting with "-" (as well
- *	 as "--"). However, newlibc's `getopt_long_only` (inexplicably) requires long options to
- *	 start with either "+" or "--". From the source:
- *
- *	> The function getopt_long_only() is identical to getopt_long(), except that a plus sign `+'
- *	> can introduce long options as well as `--'.
- *
- *	We work around this inconsistency by transforming options before `getopt_long_only` parses
- *	them to convert a single leading '-' into a '+'
+ *	Make the contents of `inputFilePath` available in memory, mapping them where
+ *	possible and reading them into a heap buffer otherwise.
  */
-static void
-modifyNextArgvForNewLibc(char * const  argv[])
+static CommonConstantReturnType
+openInputFileBuffer(const char *  inputFilePath, InputFileBuffer *  input)
 {
-	if (getOptIsNewlib())
+#ifdef COMMON_HAVE_MMAP
+	if (mapInputFileBuffer(inputFilePath, input) == kCommonConstantReturnTypeSuccess)
 	{
-		char *	arg = argv[optind == 0 ? 1 : optind];
-
-		if ((arg != NULL) && (arg[0] == '-') && (arg[1] != '-'))
-		{
-			arg[0] = '+';
-		}
+		return kCommonConstantReturnTypeSuccess;
 	}
+#endif /* COMMON_HAVE_MMAP */
+
+	return readInputFileBuffer(inputFilePath, input);
 }
 
-static void
-checkDuplicates(
-	struct option *		currentOpts,
-	size_t			currentOptsSize,
-	const char *		newOption)
+/*
+ *	Round `capacity` up so that a column of `capacity` samples of `sampleSize` bytes
+ *	takes a whole number of `kCommonConstantSampleColumnsAlignment` blocks.
+ */
+static size_t
+alignSampleColumnsCapacity(size_t  capacity, size_t  sampleSize)
 {
-	for (size_t i = 0; i < currentOptsSize; i++)
+	size_t	samplesPerBlock = kCommonConstantSampleColumnsAlignment / sampleSize;
+
+	if (capacity == 0)
 	{
-		if (strcmp(currentOpts[i].name, newOption) == 0)
-		{
-			fatal("Internal Error: Duplicate option '%s'", newOption);
-		}
+		capacity = 1;
+	}
+
+	if (capacity > SIZE_MAX - samplesPerBlock)
+	{
+		fatal("Sample columns of %zu samples per column overflow at %s:%d", capacity, __FILE__, __LINE__);
 	}
+
+	return (capacity + samplesPerBlock - 1) / samplesPerBlock * samplesPerBlock;
 }
 
-static struct option *
-constructlongOptions(
-	DemoOption *		demoOpts,
-	size_t 			demoOptsSize,
-	struct option *		optionsOut,
-	size_t			optionsOutSize)
+/*
+ *	An arena is a stack of blocks that allocations are carved from in order. Blocks
+ *	released by a reset are kept as spares and reused, so that a program which keeps
+ *	doing the same work stops calling the system allocator.
+ */
+typedef struct ArenaBlock
 {
-	/*
-	 *	Two long opts per demo opt plus zero entry.
-	 */
-	assert(optionsOutSize >= 2 * demoOptsSize + 1);
-	assert(demoOptsSize < INT_MAX);
+	struct ArenaBlock *	next;
+	size_t			size;
+	size_t			used;
+} ArenaBlock;
 
-	size_t outIndex = 0;
+struct Arena
+{
+	size_t		blockSize;
+	ArenaBlock *	blocks;
+	ArenaBlock *	spareBlocks;
+};
 
+enum
+{
+	kArenaDefaultBlockSize	= 64 * 1024,
+	kArenaMaxAlignment	= kCommonConstantSampleColumnsAlignment,
+	kArenaDefaultAlignment	= 16,
 	/*
-	 *	Demo options go first (value of option is index into opts)
+	 *	The data of a block starts this far into it, so it has the largest alignment.
 	 */
-	for (size_t i = 0; i < demoOptsSize; i++)
-	{
-		int	hasArg = demoOpts[i].hasArg ? required_argument : no_argument;
-		int	val = i;
+	kArenaBlockHeaderSize	= (sizeof(ArenaBlock) + kArenaMaxAlignment - 1) / kArenaMaxAlignment * kArenaMaxAlignment,
+};
 
-		if ((demoOpts[i].opt == NULL) && (demoOpts[i].optAlternative == NULL))
-		{
-			fatal("Internal Error: Options for demo missing both option names (index %zu).", i);
-		}
+static char *
+getArenaBlockData(ArenaBlock *  block)
+{
+	return (char *)block + kArenaBlockHeaderSize;
+}
 
-		if (demoOpts[i].opt != NULL)
-		{
-			checkDuplicates(optionsOut, outIndex, demoOpts[i].opt);
+Arena *
+createArena(size_t blockSize)
+{
+	Arena *	arena = (Arena *)checkedMalloc(sizeof(Arena), __FILE__, __LINE__);
 
-			optionsOut[outIndex] = (struct option) {
-				.name = demoOpts[i].opt,
-				.has_arg = hasArg,
-				.flag = NULL,
-				.val = val,
-			};
-			outIndex++;
-		}
+	*arena = (Arena) {
+		.blockSize = (blockSize > 0) ? blockSize : kArenaDefaultBlockSize,
+		.blocks = NULL,
+		.spareBlocks = NULL,
+	};
 
-		if (demoOpts[i].optAlternative != NULL)
+	return arena;
+}
+
+void *
+checkedArenaAlignedMalloc(Arena *  arena, size_t  alignment, size_t  size, const char *  file, int  line)
+{
+	ArenaBlock *	block = arena->blocks;
+	ArenaBlock **	spare;
+
+	assert((alignment > 0) && (alignment <= kArenaMaxAlignment) && ((alignment & (alignment - 1)) == 0));
+
+	if (size > SIZE_MAX - kArenaBlockHeaderSize - kArenaMaxAlignment)
+	{
+		fatal("Arena cannot allocate %zu bytes at %s:%d", size, file, line);
+	}
+	size = (size > 0) ? size : 1;
+
+	if (block != NULL)
+	{
+		size_t	offset = (block->used + alignment - 1) & ~(alignment - 1);
+
+		if ((offset <= block->size) && (size <= block->size - offset))
 		{
-			checkDuplicates(optionsOut, outIndex, demoOpts[i].optAlternative);
+			block->used = offset + size;
 
-			optionsOut[outIndex] = (struct option) {
-				.name = demoOpts[i].optAlternative,
-				.has_arg = hasArg,
-				.flag = NULL,
-				.val = val,
-			};
-			outIndex++;
+			return getArenaBlockData(block) + offset;
 		}
 	}
 
 	/*
-	 *	Put the final zero entry in
+	 *	Start a new block, reusing a spare one that is large enough.
 	 */
-	optionsOut[outIndex] = (struct option) { ZERO_STRUCT_INIT };
-	outIndex++;
-
-	return optionsOut;
-}
+	for (spare = &arena->spareBlocks; *spare != NULL; spare = &(*spare)->next)
+	{
+		if ((*spare)->size >= size)
+		{
+			break;
+		}
+	}
 
-static CommonConstantReturnType
+	if (*spare != NULL)
+	{
+		block = *spare;
+		*spare = block->next;
+	}
+	else
+	{
+		size_t	blockSize = (size > arena->blockSize) ? size : arena->blockSize;
+
+		block = (ArenaBlock *)checkedAlignedMalloc(kArenaMaxAlignment, kArenaBlockHeaderSize + blockSize, file, line);
+		block->size = blockSize;
+	}
+
+	block->used = size;
+	block->next = arena->blocks;
+	arena->blocks = block;
+
+	return getArenaBlockData(block);
+}
+
+void *
+checkedArenaMalloc(Arena *  arena, size_t  size, const char *  file, int  line)
+{
+	return checkedArenaAlignedMalloc(arena, kArenaDefaultAlignment, size, file, line);
+}
+
+void *
+checkedArenaCalloc(Arena *  arena, size_t  count, size_t  size, const char *  file, int  line)
+{
+	void *	allocation;
+
+	if ((size > 0) && (count > SIZE_MAX / size))
+	{
+		fatal("Arena cannot allocate %zu elements of %zu bytes at %s:%d", count, size, file, line);
+	}
+
+	allocation = checkedArenaAlignedMalloc(arena, kArenaDefaultAlignment, count * size, file, line);
+	memset(allocation, 0, count * size);
+
+	return allocation;
+}
+
+ArenaMark
+getArenaMark(const Arena *  arena)
+{
+	return (ArenaMark) {
+		.block = arena->blocks,
+		.used = (arena->blocks != NULL) ? arena->blocks->used : 0,
+	};
+}
+
+void
+resetArenaToMark(Arena *  arena, ArenaMark  mark)
+{
+	while ((arena->blocks != NULL) && (arena->blocks != mark.block))
+	{
+		ArenaBlock *	block = arena->blocks;
+
+		arena->blocks = block->next;
+		block->next = arena->spareBlocks;
+		arena->spareBlocks = block;
+	}
+
+	if (arena->blocks != NULL)
+	{
+		arena->blocks->used = mark.used;
+	}
+}
+
+void
+resetArena(Arena *  arena)
+{
+	resetArenaToMark(arena, (ArenaMark){ .block = NULL, .used = 0 });
+}
+
+void
+destroyArena(Arena *  arena)
+{
+	if (arena == NULL)
+	{
+		return;
+	}
+
+	resetArena(arena);
+	while (arena->spareBlocks != NULL)
+	{
+		ArenaBlock *	block = arena->spareBlocks;
+
+		arena->spareBlocks = block->next;
+		free(block);
+	}
+	free(arena);
+}
+
+/*
+ *	The arena that library routines take their scratch memory from on the calling
+ *	thread: the one set with `setScratchArena()`, or else one of the library's own.
+ *	Scratch memory lives until the outermost library routine returns.
+ */
+#ifdef COMMON_HAVE_PTHREADS
+static _Thread_local Arena *	scratchArena = NULL;
+static pthread_key_t		defaultScratchArenaKey;
+static pthread_once_t		defaultScratchArenaKeyOnce = PTHREAD_ONCE_INIT;
+
+static void
+destroyDefaultScratchArena(void *  arena)
+{
+	destroyArena((Arena *)arena);
+}
+
+static void
+createDefaultScratchArenaKey(void)
+{
+	if (pthread_key_create(&defaultScratchArenaKey, destroyDefaultScratchArena) != 0)
+	{
+		fatal("pthread_key_create() failed at %s:%d", __FILE__, __LINE__);
+	}
+}
+#else
+static Arena *	scratchArena = NULL;
+static Arena *	defaultScratchArena = NULL;
+#endif /* COMMON_HAVE_PTHREADS */
+
+void
+setScratchArena(Arena *  arena)
+{
+	scratchArena = arena;
+}
+
+static Arena *
+getScratchArena(void)
+{
+	if (scratchArena != NULL)
+	{
+		return scratchArena;
+	}
+
+#ifdef COMMON_HAVE_PTHREADS
+	Arena *	defaultScratchArena;
+
+	pthread_once(&defaultScratchArenaKeyOnce, createDefaultScratchArenaKey);
+	defaultScratchArena = (Arena *)pthread_getspecific(defaultScratchArenaKey);
+	if (defaultScratchArena == NULL)
+	{
+		defaultScratchArena = createArena(0);
+		pthread_setspecific(defaultScratchArenaKey, defaultScratchArena);
+	}
+#else
+	if (defaultScratchArena == NULL)
+	{
+		defaultScratchArena = createArena(0);
+	}
+#endif /* COMMON_HAVE_PTHREADS */
+
+	return defaultScratchArena;
+}
+
+static char *
+allocateSampleColumns(Arena *  arena, size_t  capacity, size_t  numberOfColumns, size_t  sampleSize)
+{
+	if (capacity > SIZE_MAX / numberOfColumns / sampleSize)
+	{
+		fatal("Sample columns of %zu samples by %zu columns overflow at %s:%d", capacity, numberOfColumns, __FILE__, __LINE__);
+	}
+
+	if (arena != NULL)
+	{
+		return (char *)checkedArenaAlignedMalloc(arena, kCommonConstantSampleColumnsAlignment, capacity * numberOfColumns * sampleSize, __FILE__, __LINE__);
+	}
+
+	return (char *)checkedAlignedMalloc(kCommonConstantSampleColumnsAlignment, capacity * numberOfColumns * sampleSize, __FILE__, __LINE__);
+}
+
+/*
+ *	Like `initSampleColumns()`, but with the columns in `arena` (on the heap if `NULL`).
+ *	`freeSampleColumns()` then leaves them to be released with the arena.
+ */
+static void
+initArenaSampleColumns(
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				initialCapacity,
+	Arena *				arena)
+{
+	size_t	sampleSize = (type == kFloatingPointVariableTypeFloat) ? sizeof(float) : sizeof(double);
+
+	assert(columns);
+	assert(numberOfColumns > 0);
+
+	if ((type != kFloatingPointVariableTypeFloat) && (type != kFloatingPointVariableTypeDouble))
+	{
+		fatal("type must be specified");
+	}
+
+	/*
+	 *	Keep at least one sample per column so that column pointers are never `NULL`.
+	 */
+	initialCapacity = alignSampleColumnsCapacity(initialCapacity, sampleSize);
+
+	*columns = (SampleColumns) {
+		.type = type,
+		.sampleSize = sampleSize,
+		.numberOfColumns = numberOfColumns,
+		.capacity = initialCapacity,
+		.sampleCounts = (arena != NULL)
+				? (size_t *)checkedArenaCalloc(arena, numberOfColumns, sizeof(size_t), __FILE__, __LINE__)
+				: (size_t *)checkedCalloc(numberOfColumns, sizeof(size_t), __FILE__, __LINE__),
+		.samples = allocateSampleColumns(arena, initialCapacity, numberOfColumns, sampleSize),
+		.arena = arena,
+	};
+}
+
+void
+initSampleColumns(
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				initialCapacity)
+{
+	initArenaSampleColumns(columns, type, numberOfColumns, initialCapacity, NULL);
+}
+
+void
+reserveSampleColumns(SampleColumns *  columns, size_t  minimumCapacity)
+{
+	size_t	newCapacity = columns->capacity;
+	char *	samples;
+
+	if (minimumCapacity <= columns->capacity)
+	{
+		return;
+	}
+
+	/*
+	 *	Doubling the capacity stores input of unknown length in amortized linear time.
+	 */
+	while (newCapacity < minimumCapacity)
+	{
+		newCapacity = (newCapacity > SIZE_MAX / 2) ? minimumCapacity : newCapacity * 2;
+	}
+	newCapacity = alignSampleColumnsCapacity(newCapacity, columns->sampleSize);
+
+	/*
+	 *	`realloc()` does not keep the alignment, so copy each column to its new stride.
+	 */
+	samples = allocateSampleColumns(columns->arena, newCapacity, columns->numberOfColumns, columns->sampleSize);
+	for (size_t column = 0; column < columns->numberOfColumns; column++)
+	{
+		memcpy(
+			samples + column * newCapacity * columns->sampleSize,
+			(char *)columns->samples + column * columns->capacity * columns->sampleSize,
+			columns->sampleCounts[column] * columns->sampleSize);
+	}
+
+	if (columns->arena == NULL)
+	{
+		free(columns->samples);
+	}
+	columns->samples = samples;
+	columns->capacity = newCapacity;
+}
+
+float *
+getFloatSampleColumn(const SampleColumns *  columns, size_t  column)
+{
+	assert(columns->type == kFloatingPointVariableTypeFloat);
+
+	return (float *)columns->samples + column * columns->capacity;
+}
+
+double *
+getDoubleSampleColumn(const SampleColumns *  columns, size_t  column)
+{
+	assert(columns->type == kFloatingPointVariableTypeDouble);
+
+	return (double *)columns->samples + column * columns->capacity;
+}
+
+void
+freeSampleColumns(SampleColumns *  columns)
+{
+	if (columns->arena == NULL)
+	{
+		free(columns->samples);
+		free(columns->sampleCounts);
+	}
+	columns->samples = NULL;
+	columns->sampleCounts = NULL;
+}
+
+/*
+ *	Upper bound on the number of lines in [`cursor`, `end`).
+ */
+static size_t
+countCSVLines(const char *  cursor, const char *  end)
+{
+	size_t	lineCount = 0;
+
+	while (cursor < end)
+	{
+		const char *	newline = (const char *)memchr(cursor, '\n', (size_t)(end - cursor));
+
+		lineCount++;
+		if (newline == NULL)
+		{
+			break;
+		}
+		cursor = newline + 1;
+	}
+
+	return lineCount;
+}
+
+/*
+ *	Return the end of the line starting at `cursor`. As with `fgets`, the line includes
+ *	its terminating '\n' if it has one.
+ */
+static const char *
+findCSVLineEnd(const char *  cursor, const char *  end)
+{
+	const char *	newline = (const char *)memchr(cursor, '\n', (size_t)(end - cursor));
+
+	return (newline == NULL) ? end : newline + 1;
+}
+
+/*
+ *	Find the next comma-delimited field of the line [`*cursor`, `lineEnd`) and advance
+ *	`*cursor` past it. Like `strtok_r`, empty fields between consecutive delimiters are
+ *	skipped. Returns false when the line has no more fields.
+ */
+static bool
+nextCSVField(
+	const char **	cursor,
+	const char *	lineEnd,
+	const char **	fieldStart,
+	const char **	fieldEnd)
+{
+	const char *	position = *cursor;
+
+	while ((position < lineEnd) && (*position == ','))
+	{
+		position++;
+	}
+
+	if (position == lineEnd)
+	{
+		*cursor = position;
+
+		return false;
+	}
+
+	*fieldStart = position;
+	while ((position < lineEnd) && (*position != ','))
+	{
+		position++;
+	}
+	*fieldEnd = position;
+	*cursor = position;
+
+	return true;
+}
+
+/*
+ *	Structural index of CSV input: the offsets of every ',' and '\n', built one block
+ *	at a time so that it takes constant space however large the input is.
+ */
+typedef enum
+{
+	kCSVStructuralIndexBlockSize	= 4096,
+} CSVStructuralIndexConstant;
+
+typedef struct
+{
+	const char *	blockBegin;
+	const char *	nextBlock;
+	const char *	end;
+	size_t		count;
+	size_t		next;
+	uint16_t	offsets[kCSVStructuralIndexBlockSize];
+} CSVStructuralIndex;
+
+/*
+ *	Write the offsets of the ',' and '\n' characters in `block` to `offsets` and return
+ *	how many there are. Compares 32 (AVX2) or 16 (SSE2, NEON) bytes at a time where
+ *	available.
+ */
+static size_t
+indexCSVStructuralCharacters(const char *  block, size_t  blockSize, uint16_t *  offsets)
+{
+	size_t	count = 0;
+	size_t	i = 0;
+
+	assert(blockSize <= kCSVStructuralIndexBlockSize);
+
+#if defined(__AVX2__)
+	const __m256i	commas = _mm256_set1_epi8(',');
+	const __m256i	newlines = _mm256_set1_epi8('\n');
+
+	for (; i + 32 <= blockSize; i += 32)
+	{
+		__m256i		bytes = _mm256_loadu_si256((const __m256i *)(block + i));
+		uint32_t	mask = (uint32_t)_mm256_movemask_epi8(
+						_mm256_or_si256(_mm256_cmpeq_epi8(bytes, commas), _mm256_cmpeq_epi8(bytes, newlines)));
+
+		while (mask != 0)
+		{
+			offsets[count++] = (uint16_t)(i + (size_t)__builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i	commas = _mm_set1_epi8(',');
+	const __m128i	newlines = _mm_set1_epi8('\n');
+
+	for (; i + 16 <= blockSize; i += 16)
+	{
+		__m128i		bytes = _mm_loadu_si128((const __m128i *)(block + i));
+		uint32_t	mask = (uint32_t)_mm_movemask_epi8(
+						_mm_or_si128(_mm_cmpeq_epi8(bytes, commas), _mm_cmpeq_epi8(bytes, newlines)));
+
+		while (mask != 0)
+		{
+			offsets[count++] = (uint16_t)(i + (size_t)__builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t	commas = vdupq_n_u8(',');
+	const uint8x16_t	newlines = vdupq_n_u8('\n');
+
+	for (; i + 16 <= blockSize; i += 16)
+	{
+		uint8x16_t	bytes = vld1q_u8((const uint8_t *)(block + i));
+		uint8x16_t	matches = vorrq_u8(vceqq_u8(bytes, commas), vceqq_u8(bytes, newlines));
+
+		/*
+		 *	NEON has no movemask: narrow each byte to a nibble instead.
+		 */
+		uint64_t	mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+
+		while (mask != 0)
+		{
+			int	bit = __builtin_ctzll(mask);
+
+			offsets[count++] = (uint16_t)(i + (size_t)(bit >> 2));
+			mask &= ~((uint64_t)0xF << (bit & ~3));
+		}
+	}
+#endif
+
+	for (; i < blockSize; i++)
+	{
+		if ((block[i] == ',') || (block[i] == '\n'))
+		{
+			offsets[count++] = (uint16_t)i;
+		}
+	}
+
+	return count;
+}
+
+/*
+ *	Return the first position in [`cursor`, `end`) that is not (C locale) whitespace,
+ *	or `end`. Tests 32 (AVX2) or 16 (SSE2, NEON) bytes at a time where available.
+ */
+static const char *
+skipCSVSpace(const char *  cursor, const char *  end)
+{
+#if defined(__AVX2__)
+	const __m256i	spaces = _mm256_set1_epi8(' ');
+	const __m256i	tabs = _mm256_set1_epi8('\t');
+	const __m256i	controlSpaceRange = _mm256_set1_epi8('\r' - '\t');
+
+	while (end - cursor >= 32)
+	{
+		__m256i		bytes = _mm256_loadu_si256((const __m256i *)cursor);
+		__m256i		controlOffset = _mm256_sub_epi8(bytes, tabs);
+		__m256i		isControlSpace = _mm256_cmpeq_epi8(_mm256_min_epu8(controlOffset, controlSpaceRange), controlOffset);
+		uint32_t	nonSpaceMask = ~(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, spaces), isControlSpace));
+
+		if (nonSpaceMask != 0)
+		{
+			return cursor + __builtin_ctz(nonSpaceMask);
+		}
+		cursor += 32;
+	}
+#elif defined(__SSE2__)
+	const __m128i	spaces = _mm_set1_epi8(' ');
+	const __m128i	tabs = _mm_set1_epi8('\t');
+	const __m128i	controlSpaceRange = _mm_set1_epi8('\r' - '\t');
+
+	while (end - cursor >= 16)
+	{
+		__m128i		bytes = _mm_loadu_si128((const __m128i *)cursor);
+		__m128i		controlOffset = _mm_sub_epi8(bytes, tabs);
+		__m128i		isControlSpace = _mm_cmpeq_epi8(_mm_min_epu8(controlOffset, controlSpaceRange), controlOffset);
+		uint32_t	nonSpaceMask = ~(uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, spaces), isControlSpace)) & 0xFFFF;
+
+		if (nonSpaceMask != 0)
+		{
+			return cursor + __builtin_ctz(nonSpaceMask);
+		}
+		cursor += 16;
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t	spaces = vdupq_n_u8(' ');
+	const uint8x16_t	tabs = vdupq_n_u8('\t');
+	const uint8x16_t	controlSpaceRange = vdupq_n_u8('\r' - '\t');
+
+	while (end - cursor >= 16)
+	{
+		uint8x16_t	bytes = vld1q_u8((const uint8_t *)cursor);
+		uint8x16_t	isSpace = vorrq_u8(vceqq_u8(bytes, spaces), vcleq_u8(vsubq_u8(bytes, tabs), controlSpaceRange));
+		uint64_t	nonSpaceMask = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(isSpace), 4)), 0);
+
+		if (nonSpaceMask != 0)
+		{
+			return cursor + (__builtin_ctzll(nonSpaceMask) >> 2);
+		}
+		cursor += 16;
+	}
+#endif
+
+	while ((cursor < end) && ((*cursor == ' ') || ((unsigned char)(*cursor - '\t') <= '\r' - '\t')))
+	{
+		cursor++;
+	}
+
+	return cursor;
+}
+
+static void
+initCSVStructuralIndex(CSVStructuralIndex *  index, const char *  begin, const char *  end)
+{
+	index->blockBegin = begin;
+	index->nextBlock = begin;
+	index->end = end;
+	index->count = 0;
+	index->next = 0;
+}
+
+/*
+ *	Return the position of the next ',' or '\n', or the end of the input if there are
+ *	no more.
+ */
+static const char *
+nextCSVStructuralCharacter(CSVStructuralIndex *  index)
+{
+	while (index->next == index->count)
+	{
+		size_t	blockSize;
+
+		if (index->nextBlock == index->end)
+		{
+			return index->end;
+		}
+
+		blockSize = (size_t)(index->end - index->nextBlock);
+		if (blockSize > kCSVStructuralIndexBlockSize)
+		{
+			blockSize = kCSVStructuralIndexBlockSize;
+		}
+
+		index->blockBegin = index->nextBlock;
+		index->nextBlock += blockSize;
+		index->count = indexCSVStructuralCharacters(index->blockBegin, blockSize, index->offsets);
+		index->next = 0;
+	}
+
+	return index->blockBegin + index->offsets[index->next++];
+}
+
+static CommonConstantReturnType
+validateInputDistributionCSVHeader(
+	const char *		actualHeaderRow,
+	const char *		actualHeaderRowEnd,
+	const char * const *	expectedHeaders,
+	size_t			numberOfExpectedHeaders)
+{
+	assert(actualHeaderRow != NULL);
+	assert(expectedHeaders != NULL);
+
+	const char *	cursor = actualHeaderRow;
+	const char *	token;
+	const char *	tokenEnd;
+	size_t		columnCount = 0;
+
+	while (nextCSVField(&cursor, actualHeaderRowEnd, &token, &tokenEnd))
+	{
+		if (columnCount == numberOfExpectedHeaders)
+		{
+			fprintf(stderr, "Error: The input CSV data has more than expected header values\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		assert(expectedHeaders[columnCount] != NULL);
+
+		size_t	expectedHeaderLength = strlen(expectedHeaders[columnCount]);
+
+		/*
+		 *	Trim leading whitespace
+		 */
+		while ((token < tokenEnd) && safeIsspace(*token))
+		{
+			token++;
+		}
+
+		/*
+		 *	Validate that the token starts with the expected header.
+		 */
+		if (((size_t)(tokenEnd - token) < expectedHeaderLength) || (strncmp(token, expectedHeaders[columnCount], expectedHeaderLength) != 0))
+		{
+			fprintf(
+				stderr,
+				"Error: Column %zu of the input CSV should have header '%s' but has header '%.*s'\n",
+				columnCount,
+				expectedHeaders[columnCount],
+				(int)(tokenEnd - token),
+				token);
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		/*
+		 *	Validate that the token ends with only whitespace (no more text)
+		 */
+		for (const char *  suffix = token + expectedHeaderLength; suffix < tokenEnd; ++suffix)
+		{
+			/*
+			 *	Check that this suffix character is whitespace.
+			 */
+			if (!safeIsspace(*suffix))
+			{
+				fprintf(
+					stderr,
+					"Error: Column %zu of the input CSV should have header '%s' but has header '%.*s' (trailing characters)\n",
+					columnCount,
+					expectedHeaders[columnCount],
+					(int)(tokenEnd - token),
+					token);
+
+				return kCommonConstantReturnTypeError;
+			}
+		}
+
+		columnCount++;
+	}
+
+	if (columnCount != numberOfExpectedHeaders)
+	{
+		fprintf(stderr, "Error: The input CSV data has less than expected header values\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+/*
+ *	Where the fields of each data row go: field `i` is stored in column
+ *	`fieldColumns[i]`, or skipped if that is `kCSVFieldSkipped`. Without a projection,
+ *	`fieldColumns` is `NULL` and every field is stored in the column of the same index.
+ */
+typedef struct
+{
+	size_t		numberOfFields;
+	size_t *	fieldColumns;
+} CSVRowLayout;
+
+static const size_t	kCSVFieldSkipped = SIZE_MAX;
+
+static void
+freeCSVRowLayout(CSVRowLayout *  layout)
+{
+	free(layout->fieldColumns);
+	layout->fieldColumns = NULL;
+}
+
+static void
+copyCSVRowLayout(CSVRowLayout *  destination, const CSVRowLayout *  source)
+{
+	*destination = (CSVRowLayout) {
+		.numberOfFields = source->numberOfFields,
+		.fieldColumns = NULL,
+	};
+
+	if (source->fieldColumns != NULL)
+	{
+		destination->fieldColumns = (size_t *)checkedMalloc(source->numberOfFields * sizeof(size_t), __FILE__, __LINE__);
+		memcpy(destination->fieldColumns, source->fieldColumns, source->numberOfFields * sizeof(size_t));
+	}
+}
+
+/*
+ *	The last header row that `readCSVHeader()` accepted and the layout it set up for
+ *	it, so that a reader which sees the same header row again, for the same expected
+ *	headers, need not check it again.
+ */
+typedef struct
+{
+	char *		row;
+	size_t		rowLength;
+	CSVRowLayout	layout;
+} CSVHeaderCache;
+
+static void
+freeCSVHeaderCache(CSVHeaderCache *  cache)
+{
+	free(cache->row);
+	freeCSVRowLayout(&cache->layout);
+	*cache = (CSVHeaderCache) { ZERO_STRUCT_INIT };
+}
+
+/*
+ *	Whether the header field [`token`, `tokenEnd`), with leading whitespace removed,
+ *	is `expectedHeader` followed only by whitespace.
+ */
+static bool
+isCSVHeaderMatch(const char *  token, const char *  tokenEnd, const char *  expectedHeader)
+{
+	size_t	expectedHeaderLength = strlen(expectedHeader);
+
+	if (((size_t)(tokenEnd - token) < expectedHeaderLength) || (strncmp(token, expectedHeader, expectedHeaderLength) != 0))
+	{
+		return false;
+	}
+
+	return skipCSVSpace(token + expectedHeaderLength, tokenEnd) == tokenEnd;
+}
+
+/*
+ *	Find each of `expectedHeaders` anywhere in the header row and set up `layout` to
+ *	store those columns, in the order of `expectedHeaders`, and skip all others. If a
+ *	header appears more than once, its first column is used.
+ */
+static CommonConstantReturnType
+projectInputDistributionCSVHeader(
+	const char *		actualHeaderRow,
+	const char *		actualHeaderRowEnd,
+	const char * const *	expectedHeaders,
+	size_t			numberOfExpectedHeaders,
+	CSVRowLayout *		layout)
+{
+	const char *	cursor = actualHeaderRow;
+	const char *	token;
+	const char *	tokenEnd;
+	bool *		isFound = (bool *)checkedCalloc(numberOfExpectedHeaders, sizeof(bool), __FILE__, __LINE__);
+	size_t		capacity = 0;
+	size_t		fieldCount = 0;
+
+	while (nextCSVField(&cursor, actualHeaderRowEnd, &token, &tokenEnd))
+	{
+		if (fieldCount == capacity)
+		{
+			capacity = (capacity == 0) ? 16 : 2 * capacity;
+			layout->fieldColumns = (size_t *)realloc(layout->fieldColumns, capacity * sizeof(size_t));
+			if (layout->fieldColumns == NULL)
+			{
+				fatal("realloc() failed to allocate %zu bytes at %s:%d", capacity * sizeof(size_t), __FILE__, __LINE__);
+			}
+		}
+
+		token = skipCSVSpace(token, tokenEnd);
+		layout->fieldColumns[fieldCount] = kCSVFieldSkipped;
+		for (size_t column = 0; column < numberOfExpectedHeaders; column++)
+		{
+			if (!isFound[column] && isCSVHeaderMatch(token, tokenEnd, expectedHeaders[column]))
+			{
+				layout->fieldColumns[fieldCount] = column;
+				isFound[column] = true;
+				break;
+			}
+		}
+		fieldCount++;
+	}
+	layout->numberOfFields = fieldCount;
+
+	for (size_t column = 0; column < numberOfExpectedHeaders; column++)
+	{
+		if (!isFound[column])
+		{
+			fprintf(stderr, "Error: The input CSV data has no column with header '%s'\n", expectedHeaders[column]);
+			free(isFound);
+
+			return kCommonConstantReturnTypeError;
+		}
+	}
+
+	free(isFound);
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+/*
+ *	Check the header row [`row`, `rowEnd`) and set up `layout` for the data rows.
+ *	Without `isProjection`, the header must list exactly `expectedHeaders`, in order.
+ *	`layout` belongs to the caller, see `freeCSVRowLayout()`, even on error. If
+ *	`headerCache` is not `NULL`, a row identical to the cached one is not checked
+ *	again, and an accepted row replaces the cached one.
+ */
+static CommonConstantReturnType
+readCSVHeader(
+	const char *		row,
+	const char *		rowEnd,
+	const char * const *	expectedHeaders,
+	size_t			numberOfColumns,
+	bool			isProjection,
+	CSVHeaderCache *	headerCache,
+	CSVRowLayout *		layout)
+{
+	CommonConstantReturnType	returnCode;
+	size_t				rowLength = (size_t)(rowEnd - row);
+
+	if ((headerCache != NULL)
+		&& (headerCache->row != NULL)
+		&& (headerCache->rowLength == rowLength)
+		&& (memcmp(headerCache->row, row, rowLength) == 0))
+	{
+		copyCSVRowLayout(layout, &headerCache->layout);
+
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	*layout = (CSVRowLayout) {
+		.numberOfFields = numberOfColumns,
+		.fieldColumns = NULL,
+	};
+
+	if (isProjection)
+	{
+		returnCode = projectInputDistributionCSVHeader(row, rowEnd, expectedHeaders, numberOfColumns, layout);
+	}
+	else
+	{
+		returnCode = validateInputDistributionCSVHeader(row, rowEnd, expectedHeaders, numberOfColumns);
+	}
+
+	if ((headerCache != NULL) && (returnCode == kCommonConstantReturnTypeSuccess))
+	{
+		freeCSVHeaderCache(headerCache);
+		headerCache->row = (char *)checkedMalloc(rowLength + 1, __FILE__, __LINE__);
+		memcpy(headerCache->row, row, rowLength);
+		headerCache->rowLength = rowLength;
+		copyCSVRowLayout(&headerCache->layout, layout);
+	}
+
+	return returnCode;
+}
+
+/*
+ *	Whether the field [`token`, `tokenEnd`) of the first data row holds a Ux-value,
+ *	which makes its whole column a Ux-value column.
+ */
+static bool
+isCSVUxValueToken(const char *  token, const char *  tokenEnd)
+{
+	for (const char *  c = token; c + 1 < tokenEnd; c++)
+	{
+		if ((c[0] == 'U') && (c[1] == 'x'))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+typedef enum
+{
+	kCSVParseErrorKindNone,
+	kCSVParseErrorKindTooManyEntries,
+	kCSVParseErrorKindTooFewEntries,
+	kCSVParseErrorKindInvalidNumber,
+} CSVParseErrorKind;
+
+/*
+ *	The first error found while parsing a run of CSV rows. Rows are counted from the
+ *	start of the run, so that runs parsed concurrently can be reported with their
+ *	global row numbers once the rows before them have been counted.
+ */
+typedef struct
+{
+	CSVParseErrorKind	kind;
+	int64_t			row;
+	size_t			column;
+	const char *		token;
+	size_t			tokenLength;
+} CSVParseError;
+
+static void
+reportCSVParseError(const CSVParseError *  error, int64_t  firstRow)
+{
+	int64_t	row = firstRow + error->row;
+
+	switch (error->kind)
+	{
+		case kCSVParseErrorKindTooManyEntries:
+		{
+			fprintf(stderr,
+				"Error: The input CSV data has more than the expected entries "
+				"at data row %" PRIi64 ".\n",
+				row);
+			break;
+		}
+		case kCSVParseErrorKindTooFewEntries:
+		{
+			fprintf(stderr,
+				"Error: The input CSV data has less than expected entries at data "
+				"row %" PRId64 ".\n",
+				row);
+			break;
+		}
+		case kCSVParseErrorKindInvalidNumber:
+		{
+			/*
+			 *	The token is the field alone. The strtok_r reader printed the
+			 *	line terminator of a last field as part of it.
+			 */
+			fprintf(stderr,
+				"Error: The input CSV data at row %" PRId64 " and column %zu is not a valid number (was '%.*s').\n",
+				row,
+				error->column,
+				(int)error->tokenLength,
+				error->token);
+			break;
+		}
+		case kCSVParseErrorKindNone:
+		default:
+		{
+			break;
+		}
+	}
+}
+
+/*
+ *	Parse the data rows in [`cursor`, `end`) into `columns`, which must have room for
+ *	one sample per line, with the fields of each row stored as `layout` says. Ux
+ *	columns are detected on the first row only if `detectUxColumns` is set, otherwise
+ *	`uxColumns` is only read. Always inlined with a constant `type`, the type of
+ *	`columns`, so that each sample type gets a row loop of its own without a type
+ *	test per field.
+ */
+static inline __attribute__((always_inline)) CommonConstantReturnType
+parseCSVRowsOfType(
+	const char *			cursor,
+	const char *			end,
+	bool				detectUxColumns,
+	bool *				uxColumns,
+	const CSVRowLayout *		layout,
+	SampleColumns *			columns,
+	int64_t *			rowCountOut,
+	CSVParseError *			error,
+	FloatingPointVariableType	type)
+{
+	CSVStructuralIndex	index;
+	const char *		delimiter;
+	const char *		token;
+	const char *		tokenEnd;
+	int64_t			rowCount = 0;
+	size_t			columnCount;
+	size_t			column;
+	size_t			numberOfFields = layout->numberOfFields;
+	const size_t *		fieldColumns = layout->fieldColumns;
+	size_t *		sampleCounts = columns->sampleCounts;
+	float *			floatSamples = (float *)columns->samples;
+	double *		doubleSamples = (double *)columns->samples;
+	size_t			capacity = columns->capacity;
+	float			parsedFloatValue;
+	double			parsedDoubleValue;
+	bool			isLineEnd;
+
+	*error = (CSVParseError) { ZERO_STRUCT_INIT };
+	initCSVStructuralIndex(&index, cursor, end);
+
+	/*
+	 *	Walk the structural index of the rows: every field ends at the next ',' or
+	 *	'\n' (or the end of the input).
+	 */
+	while (cursor < end)
+	{
+		columnCount = 0;
+
+		do
+		{
+			delimiter = nextCSVStructuralCharacter(&index);
+			isLineEnd = (delimiter == end) || (*delimiter == '\n');
+			token = cursor;
+			tokenEnd = delimiter;
+			cursor = (delimiter == end) ? end : delimiter + 1;
+
+			/*
+			 *	Like `strtok_r`, skip empty fields between commas and at the end of
+			 *	the input. An empty field before a newline still counts, since
+			 *	`strtok_r` returned the newline itself as a token.
+			 */
+			if ((token == tokenEnd) && ((delimiter == end) || (*delimiter == ',')))
+			{
+				continue;
+			}
+
+			if (columnCount == numberOfFields)
+			{
+				error->kind = kCSVParseErrorKindTooManyEntries;
+				error->row = rowCount;
+				*rowCountOut = rowCount;
+
+				return kCommonConstantReturnTypeError;
+			}
+
+			/*
+			 *	Fields outside the projection are skipped without being parsed.
+			 */
+			column = (fieldColumns == NULL) ? columnCount : fieldColumns[columnCount];
+			if (column == kCSVFieldSkipped)
+			{
+				columnCount++;
+				continue;
+			}
+
+			/*
+			 *	Trim leading whitespace
+			 */
+			token = skipCSVSpace(token, tokenEnd);
+
+			/*
+			 *	Only parse this value if this is not a Ux value column.
+			 */
+			if (!uxColumns[column])
+			{
+				if (detectUxColumns && (rowCount == 0))
+				{
+					uxColumns[column] = isCSVUxValueToken(token, tokenEnd);
+				}
+
+				bool	shouldIgnore = false;
+				bool	isEmpty = (token == tokenEnd);
+				bool	isValid;
+
+				if (!isEmpty && (token[0] == '-'))
+				{
+					shouldIgnore = (skipCSVSpace(token + 1, tokenEnd) == tokenEnd);
+				}
+
+				if (shouldIgnore)
+				{
+					/*
+					 *	Ignore this entry
+					 */
+					columnCount++;
+					continue;
+				}
+
+				/*
+				 *	The field is followed by ',', '\n' or '\0', which stops number
+				 *	parsing. An empty field must be rejected before parsing though,
+				 *	since leading whitespace (including newlines) would be skipped.
+				 */
+				if (type == kFloatingPointVariableTypeFloat)
+				{
+					isValid = !isEmpty && (parseFloatFast(token, &parsedFloatValue) == kCommonConstantReturnTypeSuccess);
+					if (isValid)
+					{
+						floatSamples[column * capacity + sampleCounts[column]] = parsedFloatValue;
+						sampleCounts[column]++;
+					}
+				}
+				else
+				{
+					isValid = !isEmpty && (parseDoubleFast(token, &parsedDoubleValue) == kCommonConstantReturnTypeSuccess);
+					if (isValid)
+					{
+						doubleSamples[column * capacity + sampleCounts[column]] = parsedDoubleValue;
+						sampleCounts[column]++;
+					}
+				}
+
+				if (!isValid)
+				{
+					error->kind = kCSVParseErrorKindInvalidNumber;
+					error->row = rowCount;
+					error->column = columnCount;
+					error->token = token;
+					error->tokenLength = (size_t)(tokenEnd - token);
+					*rowCountOut = rowCount;
+
+					return kCommonConstantReturnTypeError;
+				}
+			}
+
+			columnCount++;
+		} while (!isLineEnd);
+
+		if (columnCount != numberOfFields)
+		{
+			error->kind = kCSVParseErrorKindTooFewEntries;
+			error->row = rowCount;
+			*rowCountOut = rowCount;
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		rowCount++;
+	}
+
+	*rowCountOut = rowCount;
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterRowsParsed, (uint64_t)rowCount);
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+static CommonConstantReturnType
+parseFloatCSVRows(
+	const char *		cursor,
+	const char *		end,
+	bool			detectUxColumns,
+	bool *			uxColumns,
+	const CSVRowLayout *	layout,
+	SampleColumns *		columns,
+	int64_t *		rowCountOut,
+	CSVParseError *		error)
+{
+	return parseCSVRowsOfType(cursor, end, detectUxColumns, uxColumns, layout, columns, rowCountOut, error, kFloatingPointVariableTypeFloat);
+}
+
+static CommonConstantReturnType
+parseDoubleCSVRows(
+	const char *		cursor,
+	const char *		end,
+	bool			detectUxColumns,
+	bool *			uxColumns,
+	const CSVRowLayout *	layout,
+	SampleColumns *		columns,
+	int64_t *		rowCountOut,
+	CSVParseError *		error)
+{
+	return parseCSVRowsOfType(cursor, end, detectUxColumns, uxColumns, layout, columns, rowCountOut, error, kFloatingPointVariableTypeDouble);
+}
+
+/*
+ *	See `parseCSVRowsOfType()`.
+ */
+static CommonConstantReturnType
+parseCSVRows(
+	const char *		cursor,
+	const char *		end,
+	bool			detectUxColumns,
+	bool *			uxColumns,
+	const CSVRowLayout *	layout,
+	SampleColumns *		columns,
+	int64_t *		rowCountOut,
+	CSVParseError *		error)
+{
+	if (columns->type == kFloatingPointVariableTypeFloat)
+	{
+		return parseFloatCSVRows(cursor, end, detectUxColumns, uxColumns, layout, columns, rowCountOut, error);
+	}
+
+	return parseDoubleCSVRows(cursor, end, detectUxColumns, uxColumns, layout, columns, rowCountOut, error);
+}
+
+#ifdef COMMON_HAVE_MMAP
+/*
+ *	Check that every data row in [`cursor`, `end`) has `numberOfFields` fields, counted
+ *	as `parseCSVRows()` counts them, and count the rows, without converting any number.
+ *	Only the structural index is walked, so this is much faster than parsing, and a
+ *	misshapen row anywhere in the input is found before any row is parsed.
+ */
+static CommonConstantReturnType
+prescanCSVRows(
+	const char *	cursor,
+	const char *	end,
+	size_t		numberOfFields,
+	int64_t *	rowCountOut,
+	CSVParseError *	error)
+{
+	CSVStructuralIndex	index;
+	const char *		delimiter;
+	int64_t			rowCount = 0;
+	size_t			columnCount;
+	bool			isLineEnd;
+
+	*error = (CSVParseError) { ZERO_STRUCT_INIT };
+	initCSVStructuralIndex(&index, cursor, end);
+
+	while (cursor < end)
+	{
+		columnCount = 0;
+
+		do
+		{
+			delimiter = nextCSVStructuralCharacter(&index);
+			isLineEnd = (delimiter == end) || (*delimiter == '\n');
+
+			/*
+			 *	Empty fields count only before a newline, as in `parseCSVRows()`.
+			 */
+			if ((delimiter != cursor) || ((delimiter != end) && (*delimiter == '\n')))
+			{
+				columnCount++;
+			}
+			cursor = (delimiter == end) ? end : delimiter + 1;
+		} while (!isLineEnd && (columnCount <= numberOfFields));
+
+		if (columnCount != numberOfFields)
+		{
+			error->kind = (columnCount > numberOfFields) ? kCSVParseErrorKindTooManyEntries : kCSVParseErrorKindTooFewEntries;
+			error->row = rowCount;
+			*rowCountOut = rowCount;
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		rowCount++;
+	}
+
+	*rowCountOut = rowCount;
+
+	return kCommonConstantReturnTypeSuccess;
+}
+#endif /* COMMON_HAVE_MMAP */
+
+/*
+ *	Number of threads used to parse CSV data rows. See `setCSVInputParsingThreadCount()`.
+ */
+static size_t	csvInputParsingThreadCount = 1;
+
+void
+setCSVInputParsingThreadCount(size_t numberOfThreads)
+{
+	csvInputParsingThreadCount = numberOfThreads;
+}
+
+#ifdef COMMON_HAVE_PTHREADS
+/*
+ *	Most threads that one file may be parsed on by the calling thread, or 0 for no
+ *	limit beyond `csvInputParsingThreadCount`. Set while files are read concurrently,
+ *	so that the threads are shared out among them.
+ */
+static _Thread_local size_t	csvInputParsingThreadLimit = 0;
+
+/*
+ *	`csvInputParsingThreadCount`, with 0 resolved to one per online processor.
+ */
+static size_t
+getCSVInputParsingThreadCount(void)
+{
+	long	onlineProcessors;
+
+	if (csvInputParsingThreadCount > 0)
+	{
+		return csvInputParsingThreadCount;
+	}
+
+	onlineProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (onlineProcessors > 0) ? (size_t)onlineProcessors : 1;
+}
+
+/*
+ *	Number of threads worth using to parse `dataSize` bytes of CSV data rows.
+ */
+static size_t
+csvInputParsingThreadsFor(size_t dataSize)
+{
+	size_t	numberOfThreads = getCSVInputParsingThreadCount();
+	size_t	maximumUsefulThreads = dataSize / kCommonConstantMinCharsPerCSVParsingThread;
+
+	if ((csvInputParsingThreadLimit > 0) && (numberOfThreads > csvInputParsingThreadLimit))
+	{
+		numberOfThreads = csvInputParsingThreadLimit;
+	}
+
+	if (numberOfThreads > maximumUsefulThreads)
+	{
+		numberOfThreads = maximumUsefulThreads;
+	}
+
+	return (numberOfThreads == 0) ? 1 : numberOfThreads;
+}
+
+/*
+ *	One run of rows parsed by a worker thread into its own column segment.
+ */
+typedef struct
+{
+	const char *			begin;
+	const char *			end;
+	bool *				uxColumns;
+	const CSVRowLayout *		layout;
+	FloatingPointVariableType	type;
+	size_t				numberOfColumns;
+	SampleColumns			columns;
+	int64_t				rowCount;
+	CSVParseError			error;
+	CommonConstantReturnType	result;
+} CSVParseChunk;
+
+static void *
+parseCSVChunk(void *  argument)
+{
+	CSVParseChunk *	chunk = (CSVParseChunk *)argument;
+
+	initSampleColumns(&chunk->columns, chunk->type, chunk->numberOfColumns, countCSVLines(chunk->begin, chunk->end));
+	chunk->result = parseCSVRows(
+				chunk->begin,
+				chunk->end,
+				false,
+				chunk->uxColumns,
+				chunk->layout,
+				&chunk->columns,
+				&chunk->rowCount,
+				&chunk->error);
+
+	return NULL;
+}
+
+/*
+ *	Parse the data rows in [`cursor`, `end`) on `numberOfThreads` threads and stitch
+ *	the per-thread column segments together into `columns`. The first row is parsed
+ *	up front on the calling thread, since it decides which columns hold Ux values.
+ */
+static CommonConstantReturnType
+parseCSVRowsInParallel(
+	const char *			cursor,
+	const char *			end,
+	bool *				uxColumns,
+	const CSVRowLayout *		layout,
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				numberOfThreads)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeSuccess;
+	size_t				numberOfChunks = numberOfThreads + 1;
+	Arena *				scratch = getScratchArena();
+	CSVParseChunk *			chunks = (CSVParseChunk *)checkedArenaCalloc(scratch, numberOfChunks, sizeof(CSVParseChunk), __FILE__, __LINE__);
+	pthread_t *			threads = (pthread_t *)checkedArenaCalloc(scratch, numberOfChunks, sizeof(pthread_t), __FILE__, __LINE__);
+	bool *				isThreadStarted = (bool *)checkedArenaCalloc(scratch, numberOfChunks, sizeof(bool), __FILE__, __LINE__);
+	const char *			rowsBegin = findCSVLineEnd(cursor, end);
+	size_t				totalRowCount = 0;
+	int64_t				firstRow = 0;
+
+	for (size_t i = 0; i < numberOfChunks; i++)
+	{
+		chunks[i].uxColumns = uxColumns;
+		chunks[i].layout = layout;
+		chunks[i].type = type;
+		chunks[i].numberOfColumns = numberOfColumns;
+	}
+
+	/*
+	 *	Chunk 0 is the first row, the rest are split evenly and then moved forward to
+	 *	the next row boundary.
+	 */
+	chunks[0].begin = cursor;
+	chunks[0].end = rowsBegin;
+	for (size_t i = 1; i < numberOfChunks; i++)
+	{
+		chunks[i].begin = chunks[i - 1].end;
+		chunks[i].end = (i == numberOfChunks - 1)
+				? end
+				: rowsBegin + (size_t)(end - rowsBegin) / numberOfThreads * i;
+
+		if (chunks[i].end < chunks[i].begin)
+		{
+			chunks[i].end = chunks[i].begin;
+		}
+		else if ((chunks[i].end > chunks[i].begin) && (chunks[i].end < end) && (chunks[i].end[-1] != '\n'))
+		{
+			chunks[i].end = findCSVLineEnd(chunks[i].end, end);
+		}
+	}
+
+	initSampleColumns(&chunks[0].columns, type, numberOfColumns, 1);
+	chunks[0].result = parseCSVRows(
+				chunks[0].begin,
+				chunks[0].end,
+				true,
+				uxColumns,
+				layout,
+				&chunks[0].columns,
+				&chunks[0].rowCount,
+				&chunks[0].error);
+
+	if (chunks[0].result == kCommonConstantReturnTypeSuccess)
+	{
+		for (size_t i = 1; i < numberOfChunks; i++)
+		{
+			isThreadStarted[i] = (pthread_create(&threads[i], NULL, parseCSVChunk, &chunks[i]) == 0);
+			if (!isThreadStarted[i])
+			{
+				parseCSVChunk(&chunks[i]);
+			}
+		}
+
+		for (size_t i = 1; i < numberOfChunks; i++)
+		{
+			if (isThreadStarted[i])
+			{
+				pthread_join(threads[i], NULL);
+			}
+		}
+	}
+
+	/*
+	 *	Report the first error in file order, with its global row number.
+	 */
+	for (size_t i = 0; i < numberOfChunks; i++)
+	{
+		if (chunks[i].result != kCommonConstantReturnTypeSuccess)
+		{
+			reportCSVParseError(&chunks[i].error, firstRow);
+			returnCode = kCommonConstantReturnTypeError;
+			break;
+		}
+
+		firstRow += chunks[i].rowCount;
+		totalRowCount += (size_t)chunks[i].rowCount;
+	}
+
+	if (returnCode == kCommonConstantReturnTypeSuccess)
+	{
+		initArenaSampleColumns(columns, type, numberOfColumns, totalRowCount, getScratchArena());
+
+		for (size_t column = 0; column < numberOfColumns; column++)
+		{
+			char *	destination = (char *)columns->samples + column * columns->capacity * columns->sampleSize;
+
+			for (size_t i = 0; i < numberOfChunks; i++)
+			{
+				size_t	segmentSize = chunks[i].columns.sampleCounts[column] * columns->sampleSize;
+
+				memcpy(
+					destination,
+					(char *)chunks[i].columns.samples + column * chunks[i].columns.capacity * columns->sampleSize,
+					segmentSize);
+				destination += segmentSize;
+				columns->sampleCounts[column] += chunks[i].columns.sampleCounts[column];
+			}
+		}
+	}
+
+	for (size_t i = 0; i < numberOfChunks; i++)
+	{
+		freeSampleColumns(&chunks[i].columns);
+	}
+
+	/*
+	 *	`chunks`, `threads` and `isThreadStarted` are released with the caller's scratch
+	 *	memory.
+	 */
+	return returnCode;
+}
+#endif /* COMMON_HAVE_PTHREADS */
+
+/*
+ *	Streaming input: the data rows are read one block at a time into one of two
+ *	buffers, while the complete rows already in the other buffer are parsed. Only the
+ *	partial row at the end of a block is carried over, so memory use for the input
+ *	text is bounded by two blocks (or two rows, if a row is longer than a block).
+ */
+typedef enum
+{
+	kCSVInputStreamBlockSize	= 1024 * 1024,
+} CSVInputStreamConstant;
+
+/*
+ *	One pending read of up to `size` bytes from `fp` into `destination`.
+ */
+typedef struct
+{
+	FILE *		fp;
+	char *		destination;
+	size_t		size;
+	size_t		bytesRead;
+	bool		isEndOfInput;
+	bool		hasFailed;
+#ifdef COMMON_HAVE_PTHREADS
+	pthread_t	thread;
+	bool		isThreadStarted;
+#endif /* COMMON_HAVE_PTHREADS */
+} CSVInputStreamFill;
+
+static void *
+fillCSVInputStreamBuffer(void *  argument)
+{
+	CSVInputStreamFill *	fill = (CSVInputStreamFill *)argument;
+
+	fill->bytesRead = fread(fill->destination, 1, fill->size, fill->fp);
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesRead, fill->bytesRead);
+	fill->isEndOfInput = (fill->bytesRead < fill->size);
+	fill->hasFailed = (ferror(fill->fp) != 0);
+
+	return NULL;
+}
+
+/*
+ *	Start reading the next block into `destination`. Where threads are available the
+ *	read runs concurrently with the caller until `finishCSVInputStreamFill()`.
+ */
+static void
+startCSVInputStreamFill(CSVInputStreamFill *  fill, FILE *  fp, char *  destination, size_t  size)
+{
+	*fill = (CSVInputStreamFill) {
+		.fp = fp,
+		.destination = destination,
+		.size = size,
+	};
+
+#ifdef COMMON_HAVE_PTHREADS
+	fill->isThreadStarted = (pthread_create(&fill->thread, NULL, fillCSVInputStreamBuffer, fill) == 0);
+	if (fill->isThreadStarted)
+	{
+		return;
+	}
+#endif /* COMMON_HAVE_PTHREADS */
+
+	fillCSVInputStreamBuffer(fill);
+}
+
+static void
+finishCSVInputStreamFill(CSVInputStreamFill *  fill)
+{
+#ifdef COMMON_HAVE_PTHREADS
+	if (fill->isThreadStarted)
+	{
+		pthread_join(fill->thread, NULL);
+		fill->isThreadStarted = false;
+	}
+#else
+	/*
+	 *	Without threads, `startCSVInputStreamFill()` already read the block.
+	 */
+	(void)fill;
+#endif /* COMMON_HAVE_PTHREADS */
+}
+
+/*
+ *	Make sure `*buffer` can hold `size` bytes.
+ */
+static void
+reserveCSVInputStreamBuffer(char **  buffer, size_t *  capacity, size_t  size)
+{
+	char *	grown;
+
+	if (size <= *capacity)
+	{
+		return;
+	}
+
+	grown = (char *)realloc(*buffer, size);
+	if (grown == NULL)
+	{
+		fatal("realloc() failed to allocate %zu bytes at %s:%d", size, __FILE__, __LINE__);
+	}
+	*buffer = grown;
+	*capacity = size;
+}
+
+/*
+ *	Return the position after the last '\n' in [`begin`, `end`), or `begin` if there
+ *	is none.
+ */
+static const char *
+findLastCSVLineEnd(const char *  begin, const char *  end)
+{
+	while ((end > begin) && (end[-1] != '\n'))
+	{
+		end--;
+	}
+
+	return end;
+}
+
+/*
+ *	Bounded-memory input. See `setCSVInputSketch()`.
+ */
+static size_t	csvInputSketchSize = 0;
+static uint64_t	csvInputSketchSeed = 0;
+static bool	isCSVInputSketchVerbose = false;
+
+void
+setCSVInputSketch(size_t  sketchSize, uint64_t  seed, bool  isVerbose)
+{
+	csvInputSketchSize = sketchSize;
+	csvInputSketchSeed = seed;
+	isCSVInputSketchVerbose = isVerbose;
+}
+
+/*
+ *	Pre-scanned input. See `setCSVInputPrescan()`.
+ */
+static bool	isCSVInputPrescanEnabled = false;
+
+void
+setCSVInputPrescan(bool  isEnabled)
+{
+	isCSVInputPrescanEnabled = isEnabled;
+}
+
+/*
+ *	A uniform random sample of at most `size` of the samples of each column seen so far
+ *	(Vitter's algorithm R). Every column draws from its own random stream, so the sample
+ *	does not depend on how the input is split into blocks. A Ux-value column keeps its
+ *	first value, as in a full read.
+ */
+typedef struct
+{
+	SampleColumns		samples;
+	size_t			size;
+	uint64_t *		numberOfSamplesSeen;
+	MonteCarloRandom *	randoms;
+} CSVInputReservoir;
+
+static void
+initCSVInputReservoir(
+	CSVInputReservoir *		reservoir,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				size,
+	Arena *				arena)
+{
+	/*
+	 *	`samples.capacity` is rounded up to whole cache lines, so it is not the size.
+	 */
+	initArenaSampleColumns(&reservoir->samples, type, numberOfColumns, size, arena);
+	reservoir->size = size;
+	reservoir->numberOfSamplesSeen = (uint64_t *)checkedArenaCalloc(arena, numberOfColumns, sizeof(uint64_t), __FILE__, __LINE__);
+	reservoir->randoms = (MonteCarloRandom *)checkedArenaCalloc(arena, numberOfColumns, sizeof(MonteCarloRandom), __FILE__, __LINE__);
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		seedMonteCarloRandom(&reservoir->randoms[i], csvInputSketchSeed, i);
+	}
+}
+
+/*
+ *	Add the samples in `columns` to `reservoir` and empty `columns` for the next block.
+ */
+static void
+addCSVInputReservoirSamples(CSVInputReservoir *  reservoir, SampleColumns *  columns, const bool *  uxColumns)
+{
+	SampleColumns *	samples = &reservoir->samples;
+	size_t		sampleSize = samples->sampleSize;
+
+	for (size_t i = 0; i < columns->numberOfColumns; i++)
+	{
+		const char *	source = (const char *)columns->samples + i * columns->capacity * sampleSize;
+		char *		destination = (char *)samples->samples + i * samples->capacity * sampleSize;
+
+		for (size_t j = 0; j < columns->sampleCounts[i]; j++)
+		{
+			uint64_t	seen = reservoir->numberOfSamplesSeen[i]++;
+			uint64_t	slot;
+
+			if (seen < reservoir->size)
+			{
+				slot = seen;
+				samples->sampleCounts[i]++;
+			}
+			else if (uxColumns[i])
+			{
+				continue;
+			}
+			else
+			{
+				slot = nextMonteCarloRandom(&reservoir->randoms[i]) % (seen + 1);
+				if (slot >= reservoir->size)
+				{
+					continue;
+				}
+			}
+			memcpy(destination + slot * sampleSize, source + j * sampleSize, sampleSize);
+		}
+		columns->sampleCounts[i] = 0;
+	}
+}
+
+/*
+ *	Report how far the distribution of each column of `reservoir` may be from that of
+ *	all its samples: by the Dvoretzky-Kiefer-Wolfowitz inequality, the empirical CDF of
+ *	a uniform sample of `k` values is within sqrt(ln(2 / 0.05) / 2k) of the full one
+ *	everywhere, with probability at least 95%.
+ */
+static void
+reportCSVInputReservoir(const CSVInputReservoir *  reservoir, const bool *  uxColumns)
+{
+	for (size_t i = 0; i < reservoir->samples.numberOfColumns; i++)
+	{
+		size_t		kept = reservoir->samples.sampleCounts[i];
+		uint64_t	seen = reservoir->numberOfSamplesSeen[i];
+
+		if (uxColumns[i] || (kept == seen))
+		{
+			fprintf(stderr, "Input sketch: column %zu kept all %" PRIu64 " samples, exact.\n", i, seen);
+			continue;
+		}
+
+		fprintf(stderr,
+			"Input sketch: column %zu kept %zu of %" PRIu64 " samples, CDF within %.4f (95%% confidence).\n",
+			i,
+			kept,
+			seen,
+			sqrt(log(2.0 / 0.05) / (2.0 * (double)kept)));
+	}
+}
+
+/*
+ *	Validate the header and parse the data rows of the CSV input read from `fp`, which
+ *	need not be seekable, into `columns`. With a `sampleLimit`, the rows are parsed a
+ *	block at a time into a reservoir of at most that many samples per column, which
+ *	becomes `columns` at the end.
+ */
+static CommonConstantReturnType
+parseStreamedCSVInput(
+	FILE *				fp,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	CSVHeaderCache *		headerCache,
+	CSVRowLayout *			layout,
+	bool *				uxColumns,
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				sampleLimit)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeSuccess;
+	CSVInputStreamFill		fill = { ZERO_STRUCT_INIT };
+	CSVParseError			parseError;
+	char *				buffers[2] = { NULL, NULL };
+	size_t				capacities[2] = { 0, 0 };
+	size_t				front = 0;
+	size_t				length = 0;
+	size_t				scannedLength = 0;
+	int64_t				rowsParsed = 0;
+	int64_t				rowCount;
+	bool				isHeaderValidated = false;
+	bool				isEndOfInput = false;
+	bool				isSketched = (sampleLimit > 0);
+	CSVInputReservoir		reservoir = { ZERO_STRUCT_INIT };
+
+	*layout = (CSVRowLayout) {
+		.numberOfFields = numberOfColumns,
+		.fieldColumns = NULL,
+	};
+	initArenaSampleColumns(columns, type, numberOfColumns, 1, getScratchArena());
+	if (isSketched)
+	{
+		initCSVInputReservoir(&reservoir, type, numberOfColumns, sampleLimit, getScratchArena());
+	}
+	reserveCSVInputStreamBuffer(&buffers[0], &capacities[0], kCSVInputStreamBlockSize + 1);
+	reserveCSVInputStreamBuffer(&buffers[1], &capacities[1], kCSVInputStreamBlockSize + 1);
+
+	for (;;)
+	{
+		char *		data = buffers[front];
+		char *		back = buffers[1 - front];
+		const char *	cursor = data;
+		const char *	parseEnd;
+		size_t		tailLength;
+
+		/*
+		 *	Read synchronously until the front buffer holds at least one complete row,
+		 *	growing it if a row is longer than a block.
+		 */
+		while (!isEndOfInput && (findLastCSVLineEnd(data + scannedLength, data + length) == data + scannedLength))
+		{
+			scannedLength = length;
+			reserveCSVInputStreamBuffer(&buffers[front], &capacities[front], length + kCSVInputStreamBlockSize + 1);
+			data = buffers[front];
+			cursor = data;
+
+			startCSVInputStreamFill(&fill, fp, data + length, kCSVInputStreamBlockSize);
+			finishCSVInputStreamFill(&fill);
+			if (fill.hasFailed)
+			{
+				returnCode = kCommonConstantReturnTypeError;
+				goto done;
+			}
+			length += fill.bytesRead;
+			isEndOfInput = fill.isEndOfInput;
+		}
+
+		/*
+		 *	Parse up to the last complete row. At the end of the input, NUL-terminate
+		 *	the final field and parse everything that is left.
+		 */
+		if (isEndOfInput)
+		{
+			data[length] = '\0';
+			parseEnd = data + length;
+		}
+		else
+		{
+			parseEnd = findLastCSVLineEnd(data, data + length);
+		}
+		tailLength = (size_t)(data + length - parseEnd);
+
+		/*
+		 *	Carry the partial row over to the back buffer and fill the rest of it while
+		 *	parsing the front buffer.
+		 */
+		if (!isEndOfInput)
+		{
+			reserveCSVInputStreamBuffer(&buffers[1 - front], &capacities[1 - front], tailLength + kCSVInputStreamBlockSize + 1);
+			back = buffers[1 - front];
+			memcpy(back, parseEnd, tailLength);
+			startCSVInputStreamFill(&fill, fp, back + tailLength, kCSVInputStreamBlockSize);
+		}
+
+		/*
+		 *	Validate the row containing field/column names.
+		 */
+		if (!isHeaderValidated && (cursor < parseEnd))
+		{
+			const char *	lineEnd = findCSVLineEnd(cursor, parseEnd);
+
+			isHeaderValidated = true;
+			if (readCSVHeader(cursor, lineEnd, expectedHeaders, numberOfColumns, isProjection, headerCache, layout) != kCommonConstantReturnTypeSuccess)
+			{
+				returnCode = kCommonConstantReturnTypeError;
+			}
+			cursor = lineEnd;
+		}
+
+		if (returnCode == kCommonConstantReturnTypeSuccess)
+		{
+			reserveSampleColumns(columns, (isSketched ? 0 : (size_t)rowsParsed) + countCSVLines(cursor, parseEnd));
+			if (parseCSVRows(cursor, parseEnd, (rowsParsed == 0), uxColumns, layout, columns, &rowCount, &parseError) != kCommonConstantReturnTypeSuccess)
+			{
+				reportCSVParseError(&parseError, rowsParsed);
+				returnCode = kCommonConstantReturnTypeError;
+			}
+			else if (isSketched)
+			{
+				addCSVInputReservoirSamples(&reservoir, columns, uxColumns);
+			}
+			rowsParsed += rowCount;
+		}
+
+		if (isEndOfInput)
+		{
+			break;
+		}
+
+		finishCSVInputStreamFill(&fill);
+		if (fill.hasFailed)
+		{
+			returnCode = kCommonConstantReturnTypeError;
+		}
+		if (returnCode != kCommonConstantReturnTypeSuccess)
+		{
+			break;
+		}
+
+		front = 1 - front;
+		length = tailLength + fill.bytesRead;
+		scannedLength = tailLength;
+		isEndOfInput = fill.isEndOfInput;
+	}
+
+done:
+
+	if (fill.hasFailed)
+	{
+		fprintf(stderr, "Error: Failed to read the input CSV data.\n");
+	}
+
+	free(buffers[0]);
+	free(buffers[1]);
+
+	if (isSketched && (returnCode == kCommonConstantReturnTypeSuccess))
+	{
+		freeSampleColumns(columns);
+		*columns = reservoir.samples;
+		if (isCSVInputSketchVerbose)
+		{
+			reportCSVInputReservoir(&reservoir, uxColumns);
+		}
+	}
+
+	return returnCode;
+}
+
+#ifdef COMMON_HAVE_MMAP
+/*
+ *	Validate the header and parse the data rows of the mapped CSV input `input` into
+ *	`columns`. With a pre-scan set, see `setCSVInputPrescan()`, the shape of every row
+ *	is checked before any row is parsed.
+ */
+static CommonConstantReturnType
+parseMappedCSVInput(
+	const InputFileBuffer *		input,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	CSVHeaderCache *		headerCache,
+	CSVRowLayout *			layout,
+	bool *				uxColumns,
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns)
+{
+	const char *	cursor = input->data;
+	const char *	inputEnd = input->data + input->size;
+	const char *	lineEnd;
+	CSVParseError	parseError;
+	int64_t		rowCount;
+	int64_t		prescannedRowCount;
+#ifdef COMMON_HAVE_PTHREADS
+	size_t		numberOfThreads;
+#endif /* COMMON_HAVE_PTHREADS */
+
+	*layout = (CSVRowLayout) {
+		.numberOfFields = numberOfColumns,
+		.fieldColumns = NULL,
+	};
+
+	/*
+	 *	Validate the row containing field/column names.
+	 */
+	if (cursor < inputEnd)
+	{
+		lineEnd = findCSVLineEnd(cursor, inputEnd);
+		if (readCSVHeader(cursor, lineEnd, expectedHeaders, numberOfColumns, isProjection, headerCache, layout) != kCommonConstantReturnTypeSuccess)
+		{
+			return kCommonConstantReturnTypeError;
+		}
+		cursor = lineEnd;
+	}
+
+	/*
+	 *	Reject misshapen rows before parsing any of them. The row count is then known
+	 *	as well, so the lines need not be counted again below.
+	 */
+	prescannedRowCount = -1;
+	if (isCSVInputPrescanEnabled)
+	{
+		if (prescanCSVRows(cursor, inputEnd, layout->numberOfFields, &prescannedRowCount, &parseError) != kCommonConstantReturnTypeSuccess)
+		{
+			reportCSVParseError(&parseError, 0);
+
+			return kCommonConstantReturnTypeError;
+		}
+	}
+
+#ifdef COMMON_HAVE_PTHREADS
+	numberOfThreads = csvInputParsingThreadsFor((size_t)(inputEnd - cursor));
+	if (numberOfThreads > 1)
+	{
+		return parseCSVRowsInParallel(
+				cursor,
+				inputEnd,
+				uxColumns,
+				layout,
+				columns,
+				type,
+				numberOfColumns,
+				numberOfThreads);
+	}
+#endif /* COMMON_HAVE_PTHREADS */
+
+	/*
+	 *	Every data row holds at most one sample per column, so counting lines sizes
+	 *	the column storage exactly and it never has to grow.
+	 */
+	initArenaSampleColumns(
+		columns,
+		type,
+		numberOfColumns,
+		(prescannedRowCount >= 0) ? (size_t)prescannedRowCount : countCSVLines(cursor, inputEnd),
+		getScratchArena());
+
+	if (parseCSVRows(cursor, inputEnd, true, uxColumns, layout, columns, &rowCount, &parseError) != kCommonConstantReturnTypeSuccess)
+	{
+		reportCSVParseError(&parseError, 0);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+#endif /* COMMON_HAVE_MMAP */
+
+/*
+ *	Check the header and parse the data rows of the CSV input `inputFilePath` into
+ *	`columns`, projecting the data rows onto `expectedHeaders` if `isProjection` is
+ *	set. Regular files are mapped into memory and parsed in place, anything else
+ *	(including "stdin") is streamed. `layout` receives the layout of the data rows and
+ *	belongs to the caller, see `freeCSVRowLayout()`, even on error. If
+ *	`isSketchAllowed` and an input sketch is set, see `setCSVInputSketch()`, regular
+ *	files are streamed too and `columns` receives a reservoir of their samples.
+ */
+static CommonConstantReturnType
+readCSVInputColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	CSVHeaderCache *		headerCache,
+	CSVRowLayout *			layout,
+	bool *				uxColumns,
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	bool				isSketchAllowed)
+{
+	CommonConstantReturnType	parseResult;
+#ifdef COMMON_HAVE_MMAP
+	InputFileBuffer			input = { ZERO_STRUCT_INIT };
+#endif /* COMMON_HAVE_MMAP */
+	FILE *				fp = NULL;
+	size_t				sampleLimit = isSketchAllowed ? csvInputSketchSize : 0;
+
+	*layout = (CSVRowLayout) {
+		.numberOfFields = numberOfColumns,
+		.fieldColumns = NULL,
+	};
+
+	if (strcmp(inputFilePath, "stdin"))
+	{
+#ifdef COMMON_HAVE_MMAP
+		if ((sampleLimit == 0) && (mapCSVInputBuffer(inputFilePath, &input) == kCommonConstantReturnTypeSuccess))
+		{
+			parseResult = parseMappedCSVInput(
+						&input,
+						expectedHeaders,
+						isProjection,
+						headerCache,
+						layout,
+						uxColumns,
+						columns,
+						type,
+						numberOfColumns);
+			closeInputFileBuffer(&input);
+		}
+		else
+#endif /* COMMON_HAVE_MMAP */
+		{
+			fp = fopen(inputFilePath, "r");
+			if (fp == NULL)
+			{
+				fprintf(stderr, "Error: Cannot open the file %s.\n", inputFilePath);
+
+				return kCommonConstantReturnTypeError;
+			}
+
+			parseResult = parseStreamedCSVInput(
+						fp,
+						expectedHeaders,
+						isProjection,
+						headerCache,
+						layout,
+						uxColumns,
+						columns,
+						type,
+						numberOfColumns,
+						sampleLimit);
+			fclose(fp);
+		}
+	}
+	else
+	{
+		parseResult = parseStreamedCSVInput(
+					stdin,
+					expectedHeaders,
+					isProjection,
+					headerCache,
+					layout,
+					uxColumns,
+					columns,
+					type,
+					numberOfColumns,
+					sampleLimit);
+	}
+
+	return parseResult;
+}
+
+/*
+ *	Binary columns files. All integers are little-endian and all offsets are from the
+ *	start of the file:
+ *
+ *		offset	size	field
+ *		0	8	magic, `kBinaryColumnsMagic`
+ *		8	4	format version, `kBinaryColumnsVersion`
+ *		12	4	number of columns
+ *		16	4	sample type, a `FloatingPointVariableType`
+ *		20	4	reserved, zero
+ *		24	8	file size
+ *		32	32 * n	column descriptors
+ *
+ *	followed by the NUL-terminated column names and then the column data, each column
+ *	starting at a multiple of `kBinaryColumnsAlignment`. A column descriptor is:
+ *
+ *		offset	size	field
+ *		0	4	column kind, a `BinaryColumnsColumnKind`
+ *		4	4	name length, excluding the NUL terminator
+ *		8	8	name offset
+ *		16	8	data offset
+ *		24	8	number of samples, or length of the Ux-value text excluding
+ *				its NUL terminator
+ */
+typedef enum
+{
+	kBinaryColumnsVersion		= 1,
+	kBinaryColumnsHeaderSize	= 32,
+	kBinaryColumnsDescriptorSize	= 32,
+	kBinaryColumnsAlignment		= 64,
+} BinaryColumnsConstant;
+
+typedef enum
+{
+	kBinaryColumnsColumnKindSamples	= 1,
+	kBinaryColumnsColumnKindUxValue	= 2,
+} BinaryColumnsColumnKind;
+
+/*
+ *	Like PNG's, the magic starts with a non-ASCII byte so it is never mistaken for a
+ *	CSV header, and ends with "\r\n" so that newline translation is detected.
+ */
+static const char	kBinaryColumnsMagic[8] = { '\x89', 'U', 'x', 'C', 'o', 'l', '\r', '\n' };
+
+typedef struct
+{
+	BinaryColumnsColumnKind	kind;
+	const char *		name;
+	uint64_t		dataOffset;
+	uint64_t		count;
+} BinaryColumnsDescriptor;
+
+static bool
+isHostLittleEndian(void)
+{
+	const uint16_t	probe = 1;
+
+	return *(const uint8_t *)&probe == 1;
+}
+
+static uint32_t
+loadLittleEndian32(const char *  bytes)
+{
+	uint32_t	value = 0;
+
+	for (int i = 3; i >= 0; i--)
+	{
+		value = (value << 8) | (uint8_t)bytes[i];
+	}
+
+	return value;
+}
+
+static uint64_t
+loadLittleEndian64(const char *  bytes)
+{
+	return ((uint64_t)loadLittleEndian32(bytes + 4) << 32) | loadLittleEndian32(bytes);
+}
+
+static void
+storeLittleEndian32(char *  bytes, uint32_t  value)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		bytes[i] = (char)(value >> (8 * i));
+	}
+}
+
+static void
+storeLittleEndian64(char *  bytes, uint64_t  value)
+{
+	storeLittleEndian32(bytes, (uint32_t)value);
+	storeLittleEndian32(bytes + 4, (uint32_t)(value >> 32));
+}
+
+static uint64_t
+alignBinaryColumnsOffset(uint64_t  offset)
+{
+	return (offset + kBinaryColumnsAlignment - 1) / kBinaryColumnsAlignment * kBinaryColumnsAlignment;
+}
+
+/*
+ *	Whether [`offset`, `offset` + `size`) lies within `input`.
+ */
+static bool
+isWithinInputFileBuffer(const InputFileBuffer *  input, uint64_t  offset, uint64_t  size)
+{
+	return (offset <= input->size) && (size <= input->size - offset);
+}
+
+InputFileFormat
+detectInputFileFormat(const char *  inputFilePath)
+{
+	char	magic[sizeof(kBinaryColumnsMagic)];
+	FILE *	fp = NULL;
+	bool	isBinaryColumns;
+
+	if (strcmp(inputFilePath, "stdin") == 0)
+	{
+		return kInputFileFormatCSV;
+	}
+
+#ifdef COMMON_HAVE_MMAP
+	/*
+	 *	Reading the magic from a pipe or FIFO would consume it, so only regular files
+	 *	are checked.
+	 */
+	struct stat	fileStatus;
+
+	if ((stat(inputFilePath, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode))
+	{
+		return kInputFileFormatCSV;
+	}
+#endif /* COMMON_HAVE_MMAP */
+
+	fp = fopen(inputFilePath, "rb");
+	if (fp == NULL)
+	{
+		return kInputFileFormatCSV;
+	}
+
+	isBinaryColumns = (fread(magic, 1, sizeof(magic), fp) == sizeof(magic)) && (memcmp(magic, kBinaryColumnsMagic, sizeof(magic)) == 0);
+	fclose(fp);
+
+	return isBinaryColumns ? kInputFileFormatBinaryColumns : kInputFileFormatCSV;
+}
+
+/*
+ *	Check the header of the binary columns file `input` and decode its column
+ *	descriptors into `*descriptors`, a new array of `*numberOfColumns` entries in the
+ *	scratch arena.
+ */
+static CommonConstantReturnType
+decodeBinaryColumnsHeader(
+	const InputFileBuffer *		input,
+	FloatingPointVariableType *	sampleType,
+	BinaryColumnsDescriptor **	descriptors,
+	size_t *			numberOfColumns)
+{
+	const char *	reason = NULL;
+	size_t		sampleSize;
+
+	*descriptors = NULL;
+	*numberOfColumns = 0;
+
+	if ((input->size < kBinaryColumnsHeaderSize) || (memcmp(input->data, kBinaryColumnsMagic, sizeof(kBinaryColumnsMagic)) != 0))
+	{
+		reason = "bad magic";
+	}
+	else if (loadLittleEndian32(input->data + 8) != kBinaryColumnsVersion)
+	{
+		reason = "unsupported version";
+	}
+	else if (loadLittleEndian64(input->data + 24) != input->size)
+	{
+		reason = "truncated";
+	}
+	else if (!isHostLittleEndian())
+	{
+		reason = "unsupported on big-endian hosts";
+	}
+
+	if (reason != NULL)
+	{
+		fprintf(stderr, "Error: The input file is not a valid binary columns file (%s).\n", reason);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	*numberOfColumns = loadLittleEndian32(input->data + 12);
+	*sampleType = (FloatingPointVariableType)loadLittleEndian32(input->data + 16);
+
+	if ((*sampleType != kFloatingPointVariableTypeFloat) && (*sampleType != kFloatingPointVariableTypeDouble))
+	{
+		fprintf(stderr, "Error: The input file is not a valid binary columns file (unknown sample type).\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+	sampleSize = (*sampleType == kFloatingPointVariableTypeFloat) ? sizeof(float) : sizeof(double);
+
+	if (!isWithinInputFileBuffer(input, kBinaryColumnsHeaderSize, (uint64_t)*numberOfColumns * kBinaryColumnsDescriptorSize))
+	{
+		fprintf(stderr, "Error: The input file is not a valid binary columns file (truncated).\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	*descriptors = (BinaryColumnsDescriptor *)checkedArenaCalloc(getScratchArena(), *numberOfColumns, sizeof(BinaryColumnsDescriptor), __FILE__, __LINE__);
+	for (size_t i = 0; i < *numberOfColumns; i++)
+	{
+		const char *	descriptor = input->data + kBinaryColumnsHeaderSize + i * kBinaryColumnsDescriptorSize;
+		uint32_t	kind = loadLittleEndian32(descriptor);
+		uint64_t	nameLength = loadLittleEndian32(descriptor + 4);
+		uint64_t	nameOffset = loadLittleEndian64(descriptor + 8);
+		uint64_t	dataOffset = loadLittleEndian64(descriptor + 16);
+		uint64_t	count = loadLittleEndian64(descriptor + 24);
+		bool		isValid = isWithinInputFileBuffer(input, nameOffset, nameLength + 1)
+					&& (input->data[nameOffset + nameLength] == '\0')
+					&& ((dataOffset % kBinaryColumnsAlignment) == 0);
+
+		switch (kind)
+		{
+			case kBinaryColumnsColumnKindSamples:
+			{
+				isValid = isValid && (count <= input->size / sampleSize) && isWithinInputFileBuffer(input, dataOffset, count * sampleSize);
+				break;
+			}
+			case kBinaryColumnsColumnKindUxValue:
+			{
+				isValid = isValid && (count < input->size) && isWithinInputFileBuffer(input, dataOffset, count + 1) && (input->data[dataOffset + count] == '\0');
+				break;
+			}
+			default:
+			{
+				isValid = false;
+				break;
+			}
+		}
+
+		if (!isValid)
+		{
+			fprintf(stderr, "Error: The input file is not a valid binary columns file (bad descriptor for column %zu).\n", i);
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		(*descriptors)[i] = (BinaryColumnsDescriptor) {
+			.kind = (BinaryColumnsColumnKind)kind,
+			.name = input->data + nameOffset,
+			.dataOffset = dataOffset,
+			.count = count,
+		};
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+CommonConstantReturnType
+readInputFloatDistributionsFromBinaryColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromBinaryColumns(
+						inputFilePath,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeFloat,
+						numberOfDistributions);
+}
+
+CommonConstantReturnType
+readInputDoubleDistributionsFromBinaryColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromBinaryColumns(
+						inputFilePath,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeDouble,
+						numberOfDistributions);
+}
+
+/*
+ *	Read the distributions from the binary columns file contents `input`.
+ */
+static CommonConstantReturnType
+readDistributionsFromBinaryColumnsBuffer(
+	const InputFileBuffer *		input,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	BinaryColumnsDescriptor *	storedDescriptors = NULL;
+	BinaryColumnsDescriptor *	descriptors = NULL;
+	size_t				numberOfStoredColumns;
+	FloatingPointVariableType	sampleType;
+	Arena *				scratch = getScratchArena();
+	ArenaMark			scratchMark = getArenaMark(scratch);
+
+	if (decodeBinaryColumnsHeader(input, &sampleType, &storedDescriptors, &numberOfStoredColumns) != kCommonConstantReturnTypeSuccess)
+	{
+		goto cleanup;
+	}
+
+	if (!isProjection && (numberOfStoredColumns != numberOfDistributions))
+	{
+		fprintf(stderr, "Error: The input binary columns file has %zu columns but %zu were expected.\n", numberOfStoredColumns, numberOfDistributions);
+
+		goto cleanup;
+	}
+
+	/*
+	 *	`descriptors[i]` is the stored column that feeds distribution `i`: the column
+	 *	at position `i`, or with projection the first column named `expectedHeaders[i]`.
+	 */
+	descriptors = (BinaryColumnsDescriptor *)checkedArenaCalloc(scratch, numberOfDistributions, sizeof(BinaryColumnsDescriptor), __FILE__, __LINE__);
+	for (size_t i = 0; i < numberOfDistributions; i++)
+	{
+		assert(expectedHeaders[i] != NULL);
+
+		if (isProjection)
+		{
+			size_t	j = 0;
+
+			while ((j < numberOfStoredColumns) && (strcmp(storedDescriptors[j].name, expectedHeaders[i]) != 0))
+			{
+				j++;
+			}
+
+			if (j == numberOfStoredColumns)
+			{
+				fprintf(stderr, "Error: The input binary columns file has no column with header '%s'\n", expectedHeaders[i]);
+
+				goto cleanup;
+			}
+
+			descriptors[i] = storedDescriptors[j];
+
+			continue;
+		}
+
+		if (strcmp(storedDescriptors[i].name, expectedHeaders[i]) != 0)
+		{
+			fprintf(
+				stderr,
+				"Error: Column %zu of the input binary columns file should have header '%s' but has header '%s'\n",
+				i,
+				expectedHeaders[i],
+				storedDescriptors[i].name);
+
+			goto cleanup;
+		}
+
+		descriptors[i] = storedDescriptors[i];
+	}
+
+	for (size_t i = 0; i < numberOfDistributions; i++)
+	{
+		const char *	data = input->data + descriptors[i].dataOffset;
+		size_t		count = (size_t)descriptors[i].count;
+
+		if (descriptors[i].kind == kBinaryColumnsColumnKindUxValue)
+		{
+			CommonConstantReturnType	parseResult;
+
+			if (inputDistributionsType == kFloatingPointVariableTypeFloat)
+			{
+				parseResult = parseFloatChecked(data, &((float *)inputDistributions)[i]);
+			}
+			else
+			{
+				parseResult = parseDoubleChecked(data, &((double *)inputDistributions)[i]);
+			}
+
+			if (parseResult != kCommonConstantReturnTypeSuccess)
+			{
+				fprintf(stderr, "Error: The Ux-value of column %zu of the input binary columns file is not a valid number (was '%s').\n", i, data);
+
+				goto cleanup;
+			}
+
+			continue;
+		}
+
+		/*
+		 *	Samples of the requested type are used in place, samples of the other type
+		 *	are converted first.
+		 */
+		if (inputDistributionsType == kFloatingPointVariableTypeFloat)
+		{
+			const float *	samples = (const float *)data;
+			ArenaMark	conversionMark = getArenaMark(scratch);
+
+			if (sampleType != kFloatingPointVariableTypeFloat)
+			{
+				float *	convertedFloatSamples = (float *)checkedArenaAlignedMalloc(scratch, kCommonConstantSampleColumnsAlignment, count * sizeof(float), __FILE__, __LINE__);
+
+				for (size_t j = 0; j < count; j++)
+				{
+					convertedFloatSamples[j] = (float)((const double *)data)[j];
+				}
+				samples = convertedFloatSamples;
+			}
+
+			COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseDistributionConstruction);
+			((float *)inputDistributions)[i] = UxHwFloatDistFromSamples((float *)samples, count);
+			COMMON_INSTRUMENT_END(kInstrumentationPhaseDistributionConstruction);
+			resetArenaToMark(scratch, conversionMark);
+		}
+		else
+		{
+			const double *	samples = (const double *)data;
+			ArenaMark	conversionMark = getArenaMark(scratch);
+
+			if (sampleType != kFloatingPointVariableTypeDouble)
+			{
+				double *	convertedDoubleSamples = (double *)checkedArenaAlignedMalloc(scratch, kCommonConstantSampleColumnsAlignment, count * sizeof(double), __FILE__, __LINE__);
+
+				for (size_t j = 0; j < count; j++)
+				{
+					convertedDoubleSamples[j] = ((const float *)data)[j];
+				}
+				samples = convertedDoubleSamples;
+			}
+
+			COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseDistributionConstruction);
+			((double *)inputDistributions)[i] = UxHwDoubleDistFromSamples((double *)samples, count);
+			COMMON_INSTRUMENT_END(kInstrumentationPhaseDistributionConstruction);
+			resetArenaToMark(scratch, conversionMark);
+		}
+	}
+
+	returnCode = kCommonConstantReturnTypeSuccess;
+
+cleanup:
+
+	resetArenaToMark(scratch, scratchMark);
+
+	return returnCode;
+}
+
+static CommonConstantReturnType
+readInputDistributionsFromBinaryColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions)
+{
+	if (numberOfDistributions == 0)
+	{
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	assert(inputFilePath);
+	assert(inputDistributions);
+	assert(expectedHeaders);
+
+	CommonConstantReturnType	returnCode;
+	InputFileBuffer			input = { ZERO_STRUCT_INIT };
+
+	if ((inputDistributionsType != kFloatingPointVariableTypeFloat) && (inputDistributionsType != kFloatingPointVariableTypeDouble))
+	{
+		fatal("inputDistributionsType must be specified");
+	}
+
+	if (openInputFileBuffer(inputFilePath, &input) != kCommonConstantReturnTypeSuccess)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", inputFilePath);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	returnCode = readDistributionsFromBinaryColumnsBuffer(
+				&input,
+				expectedHeaders,
+				isProjection,
+				inputDistributions,
+				inputDistributionsType,
+				numberOfDistributions);
+	closeInputFileBuffer(&input);
+
+	return returnCode;
+}
+
+/*
+ *	Read the next line of `fp`, including its terminating '\n' if it has one, into
+ *	`*line`, growing it as needed. Returns the length of the line, which is zero at the
+ *	end of the input.
+ */
+static size_t
+readCSVTextLine(FILE *  fp, char **  line, size_t *  capacity)
+{
+	size_t	length = 0;
+
+	for (;;)
+	{
+		if (*capacity - length < 2)
+		{
+			reserveCSVInputStreamBuffer(line, capacity, (*capacity > 0) ? 2 * *capacity : 256);
+		}
+
+		if (fgets(*line + length, (int)((*capacity - length) > INT_MAX ? INT_MAX : (*capacity - length)), fp) == NULL)
+		{
+			break;
+		}
+
+		length += strlen(*line + length);
+		if ((length > 0) && ((*line)[length - 1] == '\n'))
+		{
+			break;
+		}
+	}
+
+	return length;
+}
+
+/*
+ *	Copy [`begin`, `end`) without leading and trailing whitespace into a new
+ *	NUL-terminated string.
+ */
+static char *
+copyTrimmedCSVField(const char *  begin, const char *  end)
+{
+	char *	copy;
+
+	while ((begin < end) && safeIsspace(*begin))
+	{
+		begin++;
+	}
+	while ((end > begin) && safeIsspace(end[-1]))
+	{
+		end--;
+	}
+
+	copy = (char *)checkedMalloc((size_t)(end - begin) + 1, __FILE__, __LINE__);
+	memcpy(copy, begin, (size_t)(end - begin));
+	copy[end - begin] = '\0';
+
+	return copy;
+}
+
+/*
+ *	Read the header of the CSV file `csvFilePath` into `*names` (one trimmed name per
+ *	column) and copy the text of every Ux-value on the first data row into
+ *	`*uxValues`. Both arrays have `*numberOfColumns` entries and belong to the caller,
+ *	see `freeCSVHeadStrings()`, even on error.
+ */
+static CommonConstantReturnType
+readCSVHeadStrings(
+	const char *	csvFilePath,
+	char ***	names,
+	char ***	uxValues,
+	size_t *	numberOfColumns)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	FILE *				fp = fopen(csvFilePath, "r");
+	char *				line = NULL;
+	size_t				lineCapacity = 0;
+	size_t				lineLength;
+	const char *			cursor;
+	const char *			field;
+	const char *			fieldEnd;
+
+	*names = NULL;
+	*uxValues = NULL;
+	*numberOfColumns = 0;
+
+	if (fp == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", csvFilePath);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	lineLength = readCSVTextLine(fp, &line, &lineCapacity);
+	cursor = line;
+	while (nextCSVField(&cursor, line + lineLength, &field, &fieldEnd))
+	{
+		*names = (char **)realloc(*names, (*numberOfColumns + 1) * sizeof(char *));
+		if (*names == NULL)
+		{
+			fatal("realloc() failed to allocate %zu bytes at %s:%d", (*numberOfColumns + 1) * sizeof(char *), __FILE__, __LINE__);
+		}
+		(*names)[(*numberOfColumns)++] = copyTrimmedCSVField(field, fieldEnd);
+
+		if ((*names)[*numberOfColumns - 1][0] == '\0')
+		{
+			fprintf(stderr, "Error: Column %zu of the input CSV has an empty header.\n", *numberOfColumns - 1);
+			goto cleanup;
+		}
+	}
+
+	if (*numberOfColumns == 0)
+	{
+		fprintf(stderr, "Error: The input CSV file %s has no header.\n", csvFilePath);
+		goto cleanup;
+	}
+
+	*uxValues = (char **)checkedCalloc(*numberOfColumns, sizeof(char *), __FILE__, __LINE__);
+	lineLength = readCSVTextLine(fp, &line, &lineCapacity);
+	cursor = line;
+	for (size_t i = 0; (i < *numberOfColumns) && nextCSVField(&cursor, line + lineLength, &field, &fieldEnd); i++)
+	{
+		if (isCSVUxValueToken(field, fieldEnd))
+		{
+			(*uxValues)[i] = copyTrimmedCSVField(field, fieldEnd);
+		}
+	}
+
+	returnCode = kCommonConstantReturnTypeSuccess;
+
+cleanup:
+
+	fclose(fp);
+	free(line);
+
+	return returnCode;
+}
+
+static void
+freeCSVHeadStrings(char **  names, char **  uxValues, size_t  numberOfColumns)
+{
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		free(names[i]);
+		if (uxValues != NULL)
+		{
+			free(uxValues[i]);
+		}
+	}
+	free(names);
+	free(uxValues);
+}
+
+/*
+ *	Write `columns` to `fp` as a binary columns file. Columns flagged in `uxColumns`
+ *	are stored as the matching Ux-value text in `uxValues`, which may be `NULL`.
+ */
+static CommonConstantReturnType
+writeBinaryColumns(
+	FILE *				fp,
+	const char * const *		names,
+	char * const *			uxValues,
+	const bool *			uxColumns,
+	const SampleColumns *		columns)
+{
+	static const char	padding[kBinaryColumnsAlignment] = { ZERO_STRUCT_INIT };
+	size_t			numberOfColumns = columns->numberOfColumns;
+	size_t			sampleSize = columns->sampleSize;
+	char *			header = NULL;
+	uint64_t		headerSize;
+	uint64_t		offset;
+	bool			isWriteOk;
+
+	if (!isHostLittleEndian())
+	{
+		fprintf(stderr, "Error: Binary columns files cannot be written on big-endian hosts.\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	/*
+	 *	Lay out the names after the descriptors and the column data after the names.
+	 */
+	headerSize = kBinaryColumnsHeaderSize + (uint64_t)numberOfColumns * kBinaryColumnsDescriptorSize;
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		headerSize += strlen(names[i]) + 1;
+	}
+	headerSize = alignBinaryColumnsOffset(headerSize);
+
+	header = (char *)checkedCalloc((size_t)headerSize, 1, __FILE__, __LINE__);
+	memcpy(header, kBinaryColumnsMagic, sizeof(kBinaryColumnsMagic));
+	storeLittleEndian32(header + 8, kBinaryColumnsVersion);
+	storeLittleEndian32(header + 12, (uint32_t)numberOfColumns);
+	storeLittleEndian32(header + 16, (uint32_t)columns->type);
+
+	offset = kBinaryColumnsHeaderSize + (uint64_t)numberOfColumns * kBinaryColumnsDescriptorSize;
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		char *	descriptor = header + kBinaryColumnsHeaderSize + i * kBinaryColumnsDescriptorSize;
+		size_t	nameLength = strlen(names[i]);
+
+		storeLittleEndian32(descriptor + 4, (uint32_t)nameLength);
+		storeLittleEndian64(descriptor + 8, offset);
+		memcpy(header + offset, names[i], nameLength + 1);
+		offset += nameLength + 1;
+	}
+
+	offset = headerSize;
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		char *		descriptor = header + kBinaryColumnsHeaderSize + i * kBinaryColumnsDescriptorSize;
+		bool		isUxValue = uxColumns[i] && (uxValues != NULL) && (uxValues[i] != NULL);
+		uint64_t	count = isUxValue ? strlen(uxValues[i]) : columns->sampleCounts[i];
+
+		storeLittleEndian32(descriptor, isUxValue ? kBinaryColumnsColumnKindUxValue : kBinaryColumnsColumnKindSamples);
+		storeLittleEndian64(descriptor + 16, offset);
+		storeLittleEndian64(descriptor + 24, count);
+		offset = alignBinaryColumnsOffset(offset + (isUxValue ? count + 1 : count * sampleSize));
+	}
+	storeLittleEndian64(header + 24, offset);
+
+	isWriteOk = (fwrite(header, 1, (size_t)headerSize, fp) == headerSize);
+	offset = headerSize;
+	for (size_t i = 0; isWriteOk && (i < numberOfColumns); i++)
+	{
+		bool		isUxValue = uxColumns[i] && (uxValues != NULL) && (uxValues[i] != NULL);
+		const char *	data = isUxValue ? uxValues[i] : (const char *)columns->samples + i * columns->capacity * sampleSize;
+		size_t		size = isUxValue ? strlen(uxValues[i]) + 1 : columns->sampleCounts[i] * sampleSize;
+		uint64_t	alignedEnd = alignBinaryColumnsOffset(offset + size);
+
+		isWriteOk = (fwrite(data, 1, size, fp) == size)
+				&& (fwrite(padding, 1, (size_t)(alignedEnd - offset - size), fp) == alignedEnd - offset - size);
+		offset = alignedEnd;
+	}
+
+	free(header);
+
+	return isWriteOk ? kCommonConstantReturnTypeSuccess : kCommonConstantReturnTypeError;
+}
+
+CommonConstantReturnType
+convertCSVToBinaryColumns(
+	const char *			csvFilePath,
+	const char *			binaryFilePath,
+	FloatingPointVariableType	sampleType)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	SampleColumns			columns = { ZERO_STRUCT_INIT };
+	CSVRowLayout			layout = { ZERO_STRUCT_INIT };
+	FILE *				fp = NULL;
+	char **				names = NULL;
+	char **				uxValues = NULL;
+	bool *				uxColumns = NULL;
+	size_t				numberOfColumns = 0;
+	bool				isWriteOk;
+	Arena *				scratch = getScratchArena();
+	ArenaMark			scratchMark = getArenaMark(scratch);
+
+	assert(csvFilePath);
+	assert(binaryFilePath);
+
+	if ((sampleType != kFloatingPointVariableTypeFloat) && (sampleType != kFloatingPointVariableTypeDouble))
+	{
+		fatal("sampleType must be specified");
+	}
+
+	/*
+	 *	The column names come from the header and the Ux-value text from the first
+	 *	data row. The samples come from the CSV reader proper.
+	 */
+	if (readCSVHeadStrings(csvFilePath, &names, &uxValues, &numberOfColumns) != kCommonConstantReturnTypeSuccess)
+	{
+		goto cleanup;
+	}
+
+	uxColumns = (bool *)checkedArenaCalloc(scratch, numberOfColumns, sizeof(bool), __FILE__, __LINE__);
+	if (readCSVInputColumns(
+			csvFilePath,
+			(const char * const *)names,
+			false,
+			NULL,
+			&layout,
+			uxColumns,
+			&columns,
+			sampleType,
+			numberOfColumns,
+			false) != kCommonConstantReturnTypeSuccess)
+	{
+		goto cleanup;
+	}
+
+	fp = fopen(binaryFilePath, "wb");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", binaryFilePath);
+		goto cleanup;
+	}
+
+	isWriteOk = (writeBinaryColumns(fp, (const char * const *)names, uxValues, uxColumns, &columns) == kCommonConstantReturnTypeSuccess);
+	isWriteOk = (fclose(fp) == 0) && isWriteOk;
+	if (!isWriteOk)
+	{
+		fprintf(stderr, "Error: Cannot write the file %s.\n", binaryFilePath);
+		goto cleanup;
+	}
+
+	returnCode = kCommonConstantReturnTypeSuccess;
+
+cleanup:
+
+	freeCSVHeadStrings(names, uxValues, numberOfColumns);
+	freeSampleColumns(&columns);
+	freeCSVRowLayout(&layout);
+	resetArenaToMark(scratch, scratchMark);
+
+	return returnCode;
+}
+
+/*
+ *	Directory of the parsed-input cache, empty while the cache is disabled. See
+ *	`setCSVInputCache()`.
+ */
+static char	csvInputCacheDirectoryPath[kCommonConstantMaxCharsPerFilepath];
+static bool	isCSVInputCacheVerbose = false;
+
+void
+setCSVInputCache(const char *  cacheDirectoryPath, bool  isVerbose)
+{
+	int	ret = snprintf(csvInputCacheDirectoryPath, sizeof(csvInputCacheDirectoryPath), "%s", (cacheDirectoryPath == NULL) ? "" : cacheDirectoryPath);
+
+	if ((ret < 0) || (ret >= (int)sizeof(csvInputCacheDirectoryPath)))
+	{
+		fprintf(stderr, "Warning: The input cache directory path is too long, the input cache is disabled.\n");
+		csvInputCacheDirectoryPath[0] = '\0';
+	}
+
+	isCSVInputCacheVerbose = isVerbose;
+}
+
+/*
+ *	64-bit FNV-1a hash of `size` bytes at `bytes`, continuing from `hash`.
+ */
+static uint64_t
+hashBytesFNV1a(uint64_t  hash, const void *  bytes, size_t  size)
+{
+	for (size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ ((const uint8_t *)bytes)[i]) * UINT64_C(0x100000001b3);
+	}
+
+	return hash;
+}
+
+#ifdef COMMON_HAVE_MMAP
+/*
+ *	A cache file is a `kCSVInputCacheHeaderSize`-byte header followed by a binary
+ *	columns file holding the parsed samples. All integers are little-endian:
+ *
+ *		offset	size	field
+ *		0	8	magic, `kCSVInputCacheMagic`
+ *		8	4	cache version, `kCSVInputCacheVersion`
+ *		12	4	sample type, a `FloatingPointVariableType`
+ *		16	8	key, see `hashCSVInputCacheKey()`
+ *		24	8	size of the CSV file
+ *		32	8	modification time of the CSV file, in nanoseconds
+ *		40	8	inode number of the CSV file
+ *		48	8	time it took to parse the CSV file, in microseconds
+ *		56	8	reserved, zero
+ *
+ *	Each cache file is named after its key, so a changed CSV file overwrites its stale
+ *	cache file on the next miss.
+ */
+typedef enum
+{
+	kCSVInputCacheVersion		= 1,
+	kCSVInputCacheHeaderSize	= 64,
+} CSVInputCacheConstant;
+
+static const char	kCSVInputCacheMagic[8] = { '\x89', 'U', 'x', 'C', 'a', 'c', 'h', 'e' };
+
+typedef struct
+{
+	char		cacheFilePath[kCommonConstantMaxCharsPerFilepath + 32];
+	struct stat	sourceStatus;
+	uint64_t	key;
+	uint64_t	startMicroseconds;
+} CSVInputCacheEntry;
+
+static uint64_t
+getFileModificationNanoseconds(const struct stat *  fileStatus)
+{
+#if defined(__APPLE__)
+	return (uint64_t)fileStatus->st_mtimespec.tv_sec * 1000000000 + (uint64_t)fileStatus->st_mtimespec.tv_nsec;
+#else
+	return (uint64_t)fileStatus->st_mtim.tv_sec * 1000000000 + (uint64_t)fileStatus->st_mtim.tv_nsec;
+#endif
+}
+
+/*
+ *	The cache key covers the canonical path of the CSV file, the expected headers,
+ *	whether they are projected and the sample type. The file's size, modification
+ *	time and inode are checked on every lookup instead, so that changing the file
+ *	invalidates its cache file.
+ */
+static uint64_t
+hashCSVInputCacheKey(
+	const char *			canonicalPath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	size_t				numberOfColumns,
+	FloatingPointVariableType	type)
+{
+	uint64_t	hash = UINT64_C(0xcbf29ce484222325);
+	uint32_t	storedType = (uint32_t)type;
+	uint8_t		storedIsProjection = isProjection ? 1 : 0;
+
+	hash = hashBytesFNV1a(hash, canonicalPath, strlen(canonicalPath) + 1);
+	for (size_t i = 0; i < numberOfColumns; i++)
+	{
+		hash = hashBytesFNV1a(hash, expectedHeaders[i], strlen(expectedHeaders[i]) + 1);
+	}
+	hash = hashBytesFNV1a(hash, &storedIsProjection, sizeof(storedIsProjection));
+
+	return hashBytesFNV1a(hash, &storedType, sizeof(storedType));
+}
+
+/*
+ *	Set up `entry` for looking up and storing `inputFilePath` in the cache. Returns
+ *	false if the cache is disabled or does not apply (for example to "stdin").
+ */
+static bool
+openCSVInputCacheEntry(
+	CSVInputCacheEntry *		entry,
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	size_t				numberOfColumns,
+	FloatingPointVariableType	type)
+{
+	char *	canonicalPath;
+	int	ret;
+
+	/*
+	 *	A sketched read does not keep all the samples, so it is neither cached nor
+	 *	answered from the cache.
+	 */
+	if ((csvInputCacheDirectoryPath[0] == '\0') || (strcmp(inputFilePath, "stdin") == 0) || (csvInputSketchSize > 0))
+	{
+		return false;
+	}
+
+	if ((stat(inputFilePath, &entry->sourceStatus) != 0) || !S_ISREG(entry->sourceStatus.st_mode))
+	{
+		return false;
+	}
+
+	canonicalPath = realpath(inputFilePath, NULL);
+	entry->key = hashCSVInputCacheKey((canonicalPath != NULL) ? canonicalPath : inputFilePath, expectedHeaders, isProjection, numberOfColumns, type);
+	free(canonicalPath);
+
+	ret = snprintf(entry->cacheFilePath, sizeof(entry->cacheFilePath), "%s/%016" PRIx64 ".uxcache", csvInputCacheDirectoryPath, entry->key);
+	if ((ret < 0) || (ret >= (int)sizeof(entry->cacheFilePath)))
+	{
+		return false;
+	}
+
+	entry->startMicroseconds = getMonotonicMicroseconds();
+
+	return true;
+}
+
+/*
+ *	Read the distributions from the cache file of `entry`, if there is one and it is
+ *	still valid.
+ */
+static CommonConstantReturnType
+readCSVInputCacheEntry(
+	const CSVInputCacheEntry *	entry,
+	const char * const *		expectedHeaders,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	InputFileBuffer			cache = { ZERO_STRUCT_INIT };
+	InputFileBuffer			columns;
+	uint64_t			parseMicroseconds;
+	uint64_t			loadMicroseconds;
+
+	if (mapInputFileBuffer(entry->cacheFilePath, &cache) != kCommonConstantReturnTypeSuccess)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
+	if ((cache.size < kCSVInputCacheHeaderSize)
+		|| (memcmp(cache.data, kCSVInputCacheMagic, sizeof(kCSVInputCacheMagic)) != 0)
+		|| (loadLittleEndian32(cache.data + 8) != kCSVInputCacheVersion)
+		|| (loadLittleEndian32(cache.data + 12) != (uint32_t)inputDistributionsType)
+		|| (loadLittleEndian64(cache.data + 16) != entry->key)
+		|| (loadLittleEndian64(cache.data + 24) != (uint64_t)entry->sourceStatus.st_size)
+		|| (loadLittleEndian64(cache.data + 32) != getFileModificationNanoseconds(&entry->sourceStatus))
+		|| (loadLittleEndian64(cache.data + 40) != (uint64_t)entry->sourceStatus.st_ino))
+	{
+		goto cleanup;
+	}
+
+	columns = (InputFileBuffer) {
+		.data = cache.data + kCSVInputCacheHeaderSize,
+		.size = cache.size - kCSVInputCacheHeaderSize,
+		.isMapped = false,
+	};
+
+	returnCode = readDistributionsFromBinaryColumnsBuffer(
+				&columns,
+				expectedHeaders,
+				false,
+				inputDistributions,
+				inputDistributionsType,
+				numberOfDistributions);
+
+	if ((returnCode == kCommonConstantReturnTypeSuccess) && isCSVInputCacheVerbose)
+	{
+		parseMicroseconds = loadLittleEndian64(cache.data + 48);
+		loadMicroseconds = getMonotonicMicroseconds() - entry->startMicroseconds;
+		fprintf(
+			stderr,
+			"Input cache hit for '%s': loaded in %.3f ms, saving %.3f ms of parsing.\n",
+			entry->cacheFilePath,
+			loadMicroseconds / 1000.0,
+			((double)parseMicroseconds - (double)loadMicroseconds) / 1000.0);
+	}
+
+cleanup:
+
+	closeInputFileBuffer(&cache);
+
+	return returnCode;
+}
+
+/*
+ *	Store the parsed `columns` of `inputFilePath`, read through `layout`, in the
+ *	cache file of `entry`. The cache file holds only the expected columns, in order.
+ *	The file is written under a temporary name and then renamed, so that concurrent
+ *	readers never see a partial cache file. Failing to write the cache is not an
+ *	error.
+ */
+static void
+writeCSVInputCacheEntry(
+	const CSVInputCacheEntry *	entry,
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	const CSVRowLayout *		layout,
+	const bool *			uxColumns,
+	const SampleColumns *		columns)
+{
+	uint64_t	parseMicroseconds = getMonotonicMicroseconds() - entry->startMicroseconds;
+	char		temporaryFilePath[sizeof(entry->cacheFilePath) + 32];
+	char		header[kCSVInputCacheHeaderSize] = { ZERO_STRUCT_INIT };
+	struct stat	sourceStatus;
+	char **		names = NULL;
+	char **		uxValues = NULL;
+	char **		projectedUxValues = NULL;
+	size_t		numberOfHeadColumns = 0;
+	bool		hasUxColumns = false;
+	bool		isWriteOk = false;
+	FILE *		fp = NULL;
+
+	/*
+	 *	Do not cache a file that changed while it was being parsed.
+	 */
+	if ((stat(inputFilePath, &sourceStatus) != 0)
+		|| (sourceStatus.st_size != entry->sourceStatus.st_size)
+		|| (getFileModificationNanoseconds(&sourceStatus) != getFileModificationNanoseconds(&entry->sourceStatus)))
+	{
+		return;
+	}
+
+	/*
+	 *	Ux-values are cached as text, which the parsed columns do not keep.
+	 */
+	for (size_t i = 0; i < columns->numberOfColumns; i++)
+	{
+		hasUxColumns = hasUxColumns || uxColumns[i];
+	}
+	if (hasUxColumns
+		&& ((readCSVHeadStrings(inputFilePath, &names, &uxValues, &numberOfHeadColumns) != kCommonConstantReturnTypeSuccess)
+			|| (numberOfHeadColumns != layout->numberOfFields)))
+	{
+		goto cleanup;
+	}
+
+	/*
+	 *	The head strings are per field of the CSV file, the cached columns are per
+	 *	expected header.
+	 */
+	if (hasUxColumns && (layout->fieldColumns != NULL))
+	{
+		projectedUxValues = (char **)checkedCalloc(columns->numberOfColumns, sizeof(char *), __FILE__, __LINE__);
+		for (size_t i = 0; i < layout->numberOfFields; i++)
+		{
+			if (layout->fieldColumns[i] != kCSVFieldSkipped)
+			{
+				projectedUxValues[layout->fieldColumns[i]] = uxValues[i];
+			}
+		}
+	}
+
+	memcpy(header, kCSVInputCacheMagic, sizeof(kCSVInputCacheMagic));
+	storeLittleEndian32(header + 8, kCSVInputCacheVersion);
+	storeLittleEndian32(header + 12, (uint32_t)columns->type);
+	storeLittleEndian64(header + 16, entry->key);
+	storeLittleEndian64(header + 24, (uint64_t)entry->sourceStatus.st_size);
+	storeLittleEndian64(header + 32, getFileModificationNanoseconds(&entry->sourceStatus));
+	storeLittleEndian64(header + 40, (uint64_t)entry->sourceStatus.st_ino);
+	storeLittleEndian64(header + 48, parseMicroseconds);
+
+	mkdir(csvInputCacheDirectoryPath, 0777);
+	snprintf(temporaryFilePath, sizeof(temporaryFilePath), "%s.%ld.tmp", entry->cacheFilePath, (long)getpid());
+
+	fp = fopen(temporaryFilePath, "wb");
+	if (fp != NULL)
+	{
+		isWriteOk = (fwrite(header, 1, sizeof(header), fp) == sizeof(header))
+				&& (writeBinaryColumns(fp, expectedHeaders, (projectedUxValues != NULL) ? projectedUxValues : uxValues, uxColumns, columns) == kCommonConstantReturnTypeSuccess);
+		isWriteOk = (fclose(fp) == 0) && isWriteOk;
+		isWriteOk = isWriteOk && (rename(temporaryFilePath, entry->cacheFilePath) == 0);
+		if (!isWriteOk)
+		{
+			remove(temporaryFilePath);
+		}
+	}
+
+cleanup:
+
+	if (isCSVInputCacheVerbose)
+	{
+		fprintf(
+			stderr,
+			"Input cache miss for '%s': parsed in %.3f ms, %s.\n",
+			entry->cacheFilePath,
+			parseMicroseconds / 1000.0,
+			isWriteOk ? "cached" : "could not write the cache file");
+	}
+
+	free(projectedUxValues);
+	freeCSVHeadStrings(names, uxValues, numberOfHeadColumns);
+}
+#endif /* COMMON_HAVE_MMAP */
+
+CommonConstantReturnType
+readInputFloatDistributionsFromCSV(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromCSV(
+						inputFilePath,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeFloat,
+						numberOfDistributions);
+}
+
+CommonConstantReturnType
+readInputDoubleDistributionsFromCSV(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromCSV(
+						inputFilePath,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeDouble,
+						numberOfDistributions);
+}
+
+CommonConstantReturnType
+readInputFloatDistributionsFromCSVColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromCSV(
+						inputFilePath,
+						expectedHeaders,
+						true,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeFloat,
+						numberOfDistributions);
+}
+
+CommonConstantReturnType
+readInputDoubleDistributionsFromCSVColumns(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions)
+{
+	return readInputDistributionsFromCSV(
+						inputFilePath,
+						expectedHeaders,
+						true,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeDouble,
+						numberOfDistributions);
+}
+
+/*
+ *	Get a distribution from the samples of each of `columns`, or take the Ux-value of a
+ *	Ux-value column, into `inputDistributions`, an array of floats or doubles as the
+ *	type of `columns` says.
+ */
+static void
+getDistributionsFromSampleColumns(
+	const SampleColumns *	columns,
+	const bool *		uxColumns,
+	void *			inputDistributions)
+{
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseDistributionConstruction);
+	if (columns->type == kFloatingPointVariableTypeFloat)
+	{
+		float *	inputFloatDistributions = (float *) inputDistributions;
+
+		for (size_t i = 0; i < columns->numberOfColumns; i++)
+		{
+			float *	inputFloatSampleValues = getFloatSampleColumn(columns, i);
+
+			if (uxColumns[i])
+			{
+				inputFloatDistributions[i] = inputFloatSampleValues[0];
+			}
+			else
+			{
+				inputFloatDistributions[i] = UxHwFloatDistFromSamples(inputFloatSampleValues, columns->sampleCounts[i]);
+			}
+		}
+	}
+	else
+	{
+		double *	inputDoubleDistributions = (double *) inputDistributions;
+
+		for (size_t i = 0; i < columns->numberOfColumns; i++)
+		{
+			double *	inputDoubleSampleValues = getDoubleSampleColumn(columns, i);
+
+			if (uxColumns[i])
+			{
+				inputDoubleDistributions[i] = inputDoubleSampleValues[0];
+			}
+			else
+			{
+				inputDoubleDistributions[i] = UxHwDoubleDistFromSamples(inputDoubleSampleValues, columns->sampleCounts[i]);
+			}
+		}
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseDistributionConstruction);
+}
+
+/*
+ *	Prepared state for repeated reads of CSV input with the same expected headers: the
+ *	last accepted header row and its layout, the Ux-column flags, and the arena that
+ *	holds the scratch memory of each read, whose blocks are kept from one read to the
+ *	next.
+ */
+struct CSVInputReader
+{
+	const char * const *		expectedHeaders;
+	bool				isProjection;
+	FloatingPointVariableType	type;
+	size_t				numberOfDistributions;
+	Arena *				arena;
+	bool *				uxColumns;
+	CSVHeaderCache			headerCache;
+};
+
+static void
+initCSVInputReader(
+	CSVInputReader *		reader,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions,
+	Arena *				arena)
+{
+	if ((type != kFloatingPointVariableTypeFloat) && (type != kFloatingPointVariableTypeDouble))
+	{
+		fatal("inputDistributionsType must be specified");
+	}
+
+	*reader = (CSVInputReader) {
+		.expectedHeaders = expectedHeaders,
+		.isProjection = isProjection,
+		.type = type,
+		.numberOfDistributions = numberOfDistributions,
+		.arena = arena,
+		.uxColumns = (bool *)checkedArenaCalloc(arena, numberOfDistributions, sizeof(bool), __FILE__, __LINE__),
+		.headerCache = { ZERO_STRUCT_INIT },
+	};
+}
+
+CSVInputReader *
+openCSVInputReader(
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions)
+{
+	CSVInputReader *	reader = (CSVInputReader *)checkedMalloc(sizeof(CSVInputReader), __FILE__, __LINE__);
+
+	assert(expectedHeaders || (numberOfDistributions == 0));
+
+	initCSVInputReader(reader, expectedHeaders, isProjection, type, numberOfDistributions, createArena(0));
+
+	return reader;
+}
+
+void
+closeCSVInputReader(CSVInputReader *  reader)
+{
+	if (reader == NULL)
+	{
+		return;
+	}
+
+	freeCSVHeaderCache(&reader->headerCache);
+	destroyArena(reader->arena);
+	free(reader);
+}
+
+CommonConstantReturnType
+readCSVInputReaderDistributions(
+	CSVInputReader *	reader,
+	const char *		inputFilePath,
+	void *			inputDistributions)
+{
+	if (reader->numberOfDistributions == 0)
+	{
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	assert(inputFilePath);
+	assert(inputDistributions);
+
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	const char * const *		expectedHeaders = reader->expectedHeaders;
+	bool				isProjection = reader->isProjection;
+	FloatingPointVariableType	inputDistributionsType = reader->type;
+	size_t				numberOfDistributions = reader->numberOfDistributions;
+	bool *				uxColumns = reader->uxColumns;
+	SampleColumns			columns = { ZERO_STRUCT_INIT };
+	CSVRowLayout			layout = { ZERO_STRUCT_INIT };
+#ifdef COMMON_HAVE_MMAP
+	CSVInputCacheEntry		cacheEntry;
+	bool				isCacheEnabled;
+#endif /* COMMON_HAVE_MMAP */
+	Arena *				previousScratchArena = scratchArena;
+	ArenaMark			scratchMark = getArenaMark(reader->arena);
+
+	/*
+	 *	Everything the read takes from the scratch arena comes from the reader's.
+	 */
+	scratchArena = reader->arena;
+
+	if (detectInputFileFormat(inputFilePath) == kInputFileFormatBinaryColumns)
+	{
+		returnCode = readInputDistributionsFromBinaryColumns(
+				inputFilePath,
+				expectedHeaders,
+				isProjection,
+				inputDistributions,
+				inputDistributionsType,
+				numberOfDistributions);
+		goto cleanup;
+	}
+
+#ifdef COMMON_HAVE_MMAP
+	isCacheEnabled = openCSVInputCacheEntry(&cacheEntry, inputFilePath, expectedHeaders, isProjection, numberOfDistributions, inputDistributionsType);
+	if (isCacheEnabled
+		&& (readCSVInputCacheEntry(
+				&cacheEntry,
+				expectedHeaders,
+				inputDistributions,
+				inputDistributionsType,
+				numberOfDistributions) == kCommonConstantReturnTypeSuccess))
+	{
+		returnCode = kCommonConstantReturnTypeSuccess;
+		goto cleanup;
+	}
+#endif /* COMMON_HAVE_MMAP */
+
+	memset(uxColumns, 0, numberOfDistributions * sizeof(bool));
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseInputParsing);
+	returnCode = readCSVInputColumns(
+				inputFilePath,
+				expectedHeaders,
+				isProjection,
+				&reader->headerCache,
+				&layout,
+				uxColumns,
+				&columns,
+				inputDistributionsType,
+				numberOfDistributions,
+				true);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseInputParsing);
+	if (returnCode != kCommonConstantReturnTypeSuccess)
+	{
+		returnCode = kCommonConstantReturnTypeError;
+		goto cleanup;
+	}
+
+#ifdef COMMON_HAVE_MMAP
+	if (isCacheEnabled)
+	{
+		writeCSVInputCacheEntry(&cacheEntry, inputFilePath, expectedHeaders, &layout, uxColumns, &columns);
+	}
+#endif /* COMMON_HAVE_MMAP */
+
+	getDistributionsFromSampleColumns(&columns, uxColumns, inputDistributions);
+	returnCode = kCommonConstantReturnTypeSuccess;
+
+cleanup:
+
+	freeSampleColumns(&columns);
+	freeCSVRowLayout(&layout);
+	resetArenaToMark(reader->arena, scratchMark);
+	scratchArena = previousScratchArena;
+
+	return returnCode;
+}
+
+static CommonConstantReturnType
+readInputDistributionsFromCSV(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions)
+{
+	CommonConstantReturnType	returnCode;
+	CSVInputReader			reader;
+	Arena *				scratch = getScratchArena();
+	ArenaMark			scratchMark = getArenaMark(scratch);
+
+	/*
+	 *	A one-shot reader, whose state lives in the scratch arena of the calling thread.
+	 */
+	initCSVInputReader(&reader, expectedHeaders, isProjection, inputDistributionsType, numberOfDistributions, scratch);
+	returnCode = readCSVInputReaderDistributions(&reader, inputFilePath, inputDistributions);
+	freeCSVHeaderCache(&reader.headerCache);
+	resetArenaToMark(scratch, scratchMark);
+
+	return returnCode;
+}
+
+/*
+ *	Parse the CSV input `inputFilePath` into `columns`, in the arena of `reader`, and
+ *	leave them there for the caller. Ux-value columns cannot be merged with samples
+ *	from other files, so they are an error.
+ */
+static CommonConstantReturnType
+readCSVInputReaderColumns(
+	CSVInputReader *	reader,
+	const char *		inputFilePath,
+	SampleColumns *		columns)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	CSVRowLayout			layout = { ZERO_STRUCT_INIT };
+	Arena *				previousScratchArena = scratchArena;
+
+	scratchArena = reader->arena;
+	memset(reader->uxColumns, 0, reader->numberOfDistributions * sizeof(bool));
+
+	if (detectInputFileFormat(inputFilePath) == kInputFileFormatBinaryColumns)
+	{
+		fprintf(stderr, "Error: Cannot merge the samples of the binary columns file %s.\n", inputFilePath);
+		goto cleanup;
+	}
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseInputParsing);
+	returnCode = readCSVInputColumns(
+				inputFilePath,
+				reader->expectedHeaders,
+				reader->isProjection,
+				&reader->headerCache,
+				&layout,
+				reader->uxColumns,
+				columns,
+				reader->type,
+				reader->numberOfDistributions,
+				false);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseInputParsing);
+	if (returnCode != kCommonConstantReturnTypeSuccess)
+	{
+		returnCode = kCommonConstantReturnTypeError;
+		goto cleanup;
+	}
+
+	for (size_t i = 0; i < reader->numberOfDistributions; i++)
+	{
+		if (reader->uxColumns[i])
+		{
+			fprintf(stderr, "Error: Cannot merge the Ux-value in column %zu of %s.\n", i, inputFilePath);
+			returnCode = kCommonConstantReturnTypeError;
+			goto cleanup;
+		}
+	}
+
+cleanup:
+
+	if (returnCode != kCommonConstantReturnTypeSuccess)
+	{
+		freeSampleColumns(columns);
+	}
+	freeCSVRowLayout(&layout);
+	scratchArena = previousScratchArena;
+
+	return returnCode;
+}
+
+/*
+ *	A batch of input files read with the same expected headers. Files are claimed in
+ *	order by the reading threads, one at a time. Each thread has its own reader, so
+ *	files that share a header have it checked once per thread.
+ */
+typedef struct
+{
+	const char * const *		inputFilePaths;
+	size_t				numberOfInputFiles;
+	bool				isMerged;
+	char *				inputDistributions;
+	size_t				sampleSize;
+	size_t				numberOfDistributions;
+	CommonConstantReturnType *	fileReturnCodes;
+	SampleColumns *			fileColumns;
+	size_t				nextFile;
+#ifdef COMMON_HAVE_PTHREADS
+	size_t				parsingThreadLimit;
+	pthread_mutex_t			mutex;
+#endif /* COMMON_HAVE_PTHREADS */
+} CSVInputBatch;
+
+typedef struct
+{
+	CSVInputBatch *	batch;
+	CSVInputReader	reader;
+} CSVInputBatchWorker;
+
+static void *
+readCSVInputBatchFiles(void *  argument)
+{
+	CSVInputBatchWorker *	worker = (CSVInputBatchWorker *)argument;
+	CSVInputBatch *		batch = worker->batch;
+
+#ifdef COMMON_HAVE_PTHREADS
+	size_t			previousParsingThreadLimit = csvInputParsingThreadLimit;
+
+	csvInputParsingThreadLimit = batch->parsingThreadLimit;
+#endif /* COMMON_HAVE_PTHREADS */
+
+	for (;;)
+	{
+		CommonConstantReturnType	result;
+		size_t				file;
+
+#ifdef COMMON_HAVE_PTHREADS
+		pthread_mutex_lock(&batch->mutex);
+#endif /* COMMON_HAVE_PTHREADS */
+		file = batch->nextFile;
+		batch->nextFile += (file < batch->numberOfInputFiles) ? 1 : 0;
+#ifdef COMMON_HAVE_PTHREADS
+		pthread_mutex_unlock(&batch->mutex);
+#endif /* COMMON_HAVE_PTHREADS */
+
+		if (file >= batch->numberOfInputFiles)
+		{
+			break;
+		}
+
+		if (batch->isMerged)
+		{
+			result = readCSVInputReaderColumns(&worker->reader, batch->inputFilePaths[file], &batch->fileColumns[file]);
+		}
+		else
+		{
+			result = readCSVInputReaderDistributions(
+					&worker->reader,
+					batch->inputFilePaths[file],
+					batch->inputDistributions + file * batch->numberOfDistributions * batch->sampleSize);
+		}
+
+		if (result != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: Failed to read the input file %s.\n", batch->inputFilePaths[file]);
+		}
+		batch->fileReturnCodes[file] = result;
+	}
+
+#ifdef COMMON_HAVE_PTHREADS
+	csvInputParsingThreadLimit = previousParsingThreadLimit;
+#endif /* COMMON_HAVE_PTHREADS */
+
+	return NULL;
+}
+
+/*
+ *	Concatenate the samples of each column over the files of `batch` that were read
+ *	and get one distribution per column from them.
+ */
+static CommonConstantReturnType
+mergeCSVInputBatchColumns(CSVInputBatch *  batch, FloatingPointVariableType  type)
+{
+	Arena *		scratch = getScratchArena();
+	ArenaMark	scratchMark = getArenaMark(scratch);
+	bool		isAnyFileRead = false;
+
+	for (size_t file = 0; file < batch->numberOfInputFiles; file++)
+	{
+		isAnyFileRead = isAnyFileRead || (batch->fileReturnCodes[file] == kCommonConstantReturnTypeSuccess);
+	}
+
+	if (!isAnyFileRead)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseDistributionConstruction);
+	for (size_t i = 0; i < batch->numberOfDistributions; i++)
+	{
+		ArenaMark	columnMark = getArenaMark(scratch);
+		size_t		numberOfSamples = 0;
+		char *		samples;
+		char *		cursor;
+
+		for (size_t file = 0; file < batch->numberOfInputFiles; file++)
+		{
+			if (batch->fileReturnCodes[file] == kCommonConstantReturnTypeSuccess)
+			{
+				numberOfSamples += batch->fileColumns[file].sampleCounts[i];
+			}
+		}
+
+		samples = (char *)checkedArenaAlignedMalloc(
+					scratch,
+					kCommonConstantSampleColumnsAlignment,
+					numberOfSamples * batch->sampleSize,
+					__FILE__,
+					__LINE__);
+		cursor = samples;
+		for (size_t file = 0; file < batch->numberOfInputFiles; file++)
+		{
+			const SampleColumns *	columns = &batch->fileColumns[file];
+			size_t			size;
+
+			if (batch->fileReturnCodes[file] != kCommonConstantReturnTypeSuccess)
+			{
+				continue;
+			}
+
+			size = columns->sampleCounts[i] * batch->sampleSize;
+			if (type == kFloatingPointVariableTypeFloat)
+			{
+				memcpy(cursor, getFloatSampleColumn(columns, i), size);
+			}
+			else
+			{
+				memcpy(cursor, getDoubleSampleColumn(columns, i), size);
+			}
+			cursor += size;
+		}
+
+		if (type == kFloatingPointVariableTypeFloat)
+		{
+			((float *)batch->inputDistributions)[i] = UxHwFloatDistFromSamples((float *)samples, numberOfSamples);
+		}
+		else
+		{
+			((double *)batch->inputDistributions)[i] = UxHwDoubleDistFromSamples((double *)samples, numberOfSamples);
+		}
+		resetArenaToMark(scratch, columnMark);
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseDistributionConstruction);
+
+	resetArenaToMark(scratch, scratchMark);
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+/*
+ *	Read each of `inputFilePaths`, concurrently on up to the number of CSV parsing
+ *	threads, into its own `numberOfDistributions` entries of `inputDistributions` or,
+ *	if `isMerged`, into a single set of distributions built from the samples of all
+ *	the files together. A file that cannot be read is reported, and left out of a
+ *	merge, without stopping the others.
+ */
+static CommonConstantReturnType
+readInputDistributionsFromCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	bool				isMerged,
+	void *				inputDistributions,
+	FloatingPointVariableType	inputDistributionsType,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeSuccess;
+	Arena *				scratch = getScratchArena();
+	ArenaMark			scratchMark = getArenaMark(scratch);
+	size_t				numberOfThreads = 1;
+	CSVInputBatchWorker *		workers;
+	CSVInputBatch			batch = {
+						.inputFilePaths = inputFilePaths,
+						.numberOfInputFiles = numberOfInputFiles,
+						.isMerged = isMerged,
+						.inputDistributions = (char *)inputDistributions,
+						.sampleSize = (inputDistributionsType == kFloatingPointVariableTypeFloat) ? sizeof(float) : sizeof(double),
+						.numberOfDistributions = numberOfDistributions,
+					};
+
+	if ((numberOfInputFiles == 0) || (numberOfDistributions == 0))
+	{
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	assert(inputFilePaths);
+	assert(expectedHeaders);
+	assert(inputDistributions);
+
+	batch.fileReturnCodes = (CommonConstantReturnType *)checkedArenaCalloc(scratch, numberOfInputFiles, sizeof(CommonConstantReturnType), __FILE__, __LINE__);
+	batch.fileColumns = (SampleColumns *)checkedArenaCalloc(scratch, numberOfInputFiles, sizeof(SampleColumns), __FILE__, __LINE__);
+
+#ifdef COMMON_HAVE_PTHREADS
+	numberOfThreads = getCSVInputParsingThreadCount();
+	numberOfThreads = (numberOfThreads < numberOfInputFiles) ? numberOfThreads : numberOfInputFiles;
+	batch.parsingThreadLimit = getCSVInputParsingThreadCount() / numberOfThreads;
+#endif /* COMMON_HAVE_PTHREADS */
+
+	/*
+	 *	Each reader has an arena of its own, which in a merge also holds the columns
+	 *	of the files it read until they are merged.
+	 */
+	workers = (CSVInputBatchWorker *)checkedArenaCalloc(scratch, numberOfThreads, sizeof(CSVInputBatchWorker), __FILE__, __LINE__);
+	for (size_t i = 0; i < numberOfThreads; i++)
+	{
+		workers[i].batch = &batch;
+		initCSVInputReader(&workers[i].reader, expectedHeaders, false, inputDistributionsType, numberOfDistributions, createArena(0));
+	}
+
+#ifdef COMMON_HAVE_PTHREADS
+	pthread_t *	threads = (pthread_t *)checkedArenaCalloc(scratch, numberOfThreads, sizeof(pthread_t), __FILE__, __LINE__);
+	bool *		isThreadStarted = (bool *)checkedArenaCalloc(scratch, numberOfThreads, sizeof(bool), __FILE__, __LINE__);
+
+	/*
+	 *	The calling thread is worker 0. Should a thread fail to start, the others read
+	 *	its share of the files.
+	 */
+	pthread_mutex_init(&batch.mutex, NULL);
+	for (size_t i = 1; i < numberOfThreads; i++)
+	{
+		isThreadStarted[i] = (pthread_create(&threads[i], NULL, readCSVInputBatchFiles, &workers[i]) == 0);
+	}
+	readCSVInputBatchFiles(&workers[0]);
+	for (size_t i = 1; i < numberOfThreads; i++)
+	{
+		if (isThreadStarted[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+	pthread_mutex_destroy(&batch.mutex);
+#else
+	readCSVInputBatchFiles(&workers[0]);
+#endif /* COMMON_HAVE_PTHREADS */
+
+	for (size_t file = 0; file < numberOfInputFiles; file++)
+	{
+		if (batch.fileReturnCodes[file] != kCommonConstantReturnTypeSuccess)
+		{
+			returnCode = kCommonConstantReturnTypeError;
+		}
+		if (fileReturnCodes != NULL)
+		{
+			fileReturnCodes[file] = batch.fileReturnCodes[file];
+		}
+	}
+
+	if (isMerged && (mergeCSVInputBatchColumns(&batch, inputDistributionsType) != kCommonConstantReturnTypeSuccess))
+	{
+		returnCode = kCommonConstantReturnTypeError;
+	}
+
+	for (size_t i = 0; i < numberOfThreads; i++)
+	{
+		freeCSVHeaderCache(&workers[i].reader.headerCache);
+		destroyArena(workers[i].reader.arena);
+	}
+	resetArenaToMark(scratch, scratchMark);
+
+	return returnCode;
+}
+
+CommonConstantReturnType
+readInputFloatDistributionsFromCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes)
+{
+	return readInputDistributionsFromCSVFiles(
+						inputFilePaths,
+						numberOfInputFiles,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeFloat,
+						numberOfDistributions,
+						fileReturnCodes);
+}
+
+CommonConstantReturnType
+readInputDoubleDistributionsFromCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes)
+{
+	return readInputDistributionsFromCSVFiles(
+						inputFilePaths,
+						numberOfInputFiles,
+						expectedHeaders,
+						false,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeDouble,
+						numberOfDistributions,
+						fileReturnCodes);
+}
+
+CommonConstantReturnType
+readInputFloatDistributionsFromMergedCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes)
+{
+	return readInputDistributionsFromCSVFiles(
+						inputFilePaths,
+						numberOfInputFiles,
+						expectedHeaders,
+						true,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeFloat,
+						numberOfDistributions,
+						fileReturnCodes);
+}
+
+CommonConstantReturnType
+readInputDoubleDistributionsFromMergedCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes)
+{
+	return readInputDistributionsFromCSVFiles(
+						inputFilePaths,
+						numberOfInputFiles,
+						expectedHeaders,
+						true,
+						(void * ) inputDistributions,
+						kFloatingPointVariableTypeDouble,
+						numberOfDistributions,
+						fileReturnCodes);
+}
+
+/*
+ *	Parsed CSV input whose distributions are only obtained from the samples when first
+ *	asked for. The samples, the flags and the distributions obtained so far all live
+ *	in `arena`.
+ */
+struct LazyInputDistributions
+{
+	FloatingPointVariableType	type;
+	size_t				numberOfDistributions;
+	Arena *				arena;
+	SampleColumns			columns;
+	bool *				uxColumns;
+	bool *				isMaterialized;
+	float *				floatDistributions;
+	double *			doubleDistributions;
+};
+
+LazyInputDistributions *
+readLazyInputDistributionsFromCSV(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions)
+{
+	CommonConstantReturnType	returnCode = kCommonConstantReturnTypeError;
+	LazyInputDistributions *	lazy = (LazyInputDistributions *)checkedCalloc(1, sizeof(LazyInputDistributions), __FILE__, __LINE__);
+	CSVRowLayout			layout = { ZERO_STRUCT_INIT };
+	void *				distributions;
+#ifdef COMMON_HAVE_MMAP
+	CSVInputCacheEntry		cacheEntry;
+	bool				isCacheEnabled;
+#endif /* COMMON_HAVE_MMAP */
+	Arena *				previousScratchArena = scratchArena;
+
+	assert(inputFilePath);
+	assert(expectedHeaders || (numberOfDistributions == 0));
+
+	if ((type != kFloatingPointVariableTypeFloat) && (type != kFloatingPointVariableTypeDouble))
+	{
+		fatal("inputDistributionsType must be specified");
+	}
+
+	lazy->type = type;
+	lazy->numberOfDistributions = numberOfDistributions;
+	lazy->arena = createArena(0);
+	lazy->uxColumns = (bool *)checkedArenaCalloc(lazy->arena, numberOfDistributions, sizeof(bool), __FILE__, __LINE__);
+	lazy->isMaterialized = (bool *)checkedArenaCalloc(lazy->arena, numberOfDistributions, sizeof(bool), __FILE__, __LINE__);
+	if (type == kFloatingPointVariableTypeFloat)
+	{
+		lazy->floatDistributions = (float *)checkedArenaCalloc(lazy->arena, numberOfDistributions, sizeof(float), __FILE__, __LINE__);
+		distributions = lazy->floatDistributions;
+	}
+	else
+	{
+		lazy->doubleDistributions = (double *)checkedArenaCalloc(lazy->arena, numberOfDistributions, sizeof(double), __FILE__, __LINE__);
+		distributions = lazy->doubleDistributions;
+	}
+
+	if (numberOfDistributions == 0)
+	{
+		return lazy;
+	}
+
+	/*
+	 *	The parsed columns are taken from the scratch arena, so make that the one that
+	 *	outlives this call.
+	 */
+	scratchArena = lazy->arena;
+
+	/*
+	 *	Binary columns files and cached input already hold the samples in a form that is
+	 *	cheap to get at, so their distributions are all obtained up front.
+	 */
+	if (detectInputFileFormat(inputFilePath) == kInputFileFormatBinaryColumns)
+	{
+		returnCode = readInputDistributionsFromBinaryColumns(
+				inputFilePath,
+				expectedHeaders,
+				isProjection,
+				distributions,
+				type,
+				numberOfDistributions);
+		memset(lazy->isMaterialized, true, numberOfDistributions * sizeof(bool));
+		goto cleanup;
+	}
+
+#ifdef COMMON_HAVE_MMAP
+	isCacheEnabled = openCSVInputCacheEntry(&cacheEntry, inputFilePath, expectedHeaders, isProjection, numberOfDistributions, type);
+	if (isCacheEnabled
+		&& (readCSVInputCacheEntry(
+				&cacheEntry,
+				expectedHeaders,
+				distributions,
+				type,
+				numberOfDistributions) == kCommonConstantReturnTypeSuccess))
+	{
+		memset(lazy->isMaterialized, true, numberOfDistributions * sizeof(bool));
+		returnCode = kCommonConstantReturnTypeSuccess;
+		goto cleanup;
+	}
+#endif /* COMMON_HAVE_MMAP */
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseInputParsing);
+	returnCode = readCSVInputColumns(
+				inputFilePath,
+				expectedHeaders,
+				isProjection,
+				NULL,
+				&layout,
+				lazy->uxColumns,
+				&lazy->columns,
+				type,
+				numberOfDistributions,
+				true);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseInputParsing);
+
+#ifdef COMMON_HAVE_MMAP
+	if (isCacheEnabled && (returnCode == kCommonConstantReturnTypeSuccess))
+	{
+		writeCSVInputCacheEntry(&cacheEntry, inputFilePath, expectedHeaders, &layout, lazy->uxColumns, &lazy->columns);
+	}
+#endif /* COMMON_HAVE_MMAP */
+
+cleanup:
+
+	freeCSVRowLayout(&layout);
+	scratchArena = previousScratchArena;
+
+	if (returnCode != kCommonConstantReturnTypeSuccess)
+	{
+		freeLazyInputDistributions(lazy);
+
+		return NULL;
+	}
+
+	return lazy;
+}
+
+size_t
+getLazyInputDistributionsCount(const LazyInputDistributions *  lazy)
+{
+	return lazy->numberOfDistributions;
+}
+
+/*
+ *	Obtain distribution `index` from its samples, unless that has already been done.
+ */
+static void
+materializeLazyInputDistribution(LazyInputDistributions *  lazy, size_t  index)
+{
+	if (index >= lazy->numberOfDistributions)
+	{
+		fatal("Lazy input distribution %zu is out of range (there are %zu) at %s:%d", index, lazy->numberOfDistributions, __FILE__, __LINE__);
+	}
+
+	if (lazy->isMaterialized[index])
+	{
+		return;
+	}
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseDistributionConstruction);
+	if (lazy->type == kFloatingPointVariableTypeFloat)
+	{
+		float *	samples = getFloatSampleColumn(&lazy->columns, index);
+
+		lazy->floatDistributions[index] = lazy->uxColumns[index]
+							? samples[0]
+							: UxHwFloatDistFromSamples(samples, lazy->columns.sampleCounts[index]);
+	}
+	else
+	{
+		double *	samples = getDoubleSampleColumn(&lazy->columns, index);
+
+		lazy->doubleDistributions[index] = lazy->uxColumns[index]
+							? samples[0]
+							: UxHwDoubleDistFromSamples(samples, lazy->columns.sampleCounts[index]);
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseDistributionConstruction);
+	lazy->isMaterialized[index] = true;
+}
+
+float
+getLazyInputFloatDistribution(LazyInputDistributions *  lazy, size_t  index)
+{
+	assert(lazy->type == kFloatingPointVariableTypeFloat);
+
+	materializeLazyInputDistribution(lazy, index);
+
+	return lazy->floatDistributions[index];
+}
+
+double
+getLazyInputDoubleDistribution(LazyInputDistributions *  lazy, size_t  index)
+{
+	assert(lazy->type == kFloatingPointVariableTypeDouble);
+
+	materializeLazyInputDistribution(lazy, index);
+
+	return lazy->doubleDistributions[index];
+}
+
+void
+freeLazyInputDistributions(LazyInputDistributions *  lazy)
+{
+	if (lazy == NULL)
+	{
+		return;
+	}
+
+	destroyArena(lazy->arena);
+	free(lazy);
+}
+
+/*
+ *	A CSV input that is read as it grows. `buffer` holds the `bufferLength` bytes read
+ *	past the last complete row, and `columns` the samples of all rows parsed so far.
+ */
+struct CSVInputTail
+{
+	FILE *				fp;
+	const char * const *		expectedHeaders;
+	bool				isProjection;
+	size_t				numberOfDistributions;
+	CSVRowLayout			layout;
+	bool				isHeaderValidated;
+	bool				hasFailed;
+	bool *				uxColumns;
+	SampleColumns			columns;
+	int64_t				numberOfRows;
+	uint64_t			offset;
+	char *				buffer;
+	size_t				bufferCapacity;
+	size_t				bufferLength;
+};
+
+CSVInputTail *
+openCSVInputTail(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions)
+{
+	CSVInputTail *	tail;
+	FILE *		fp;
+
+	assert(inputFilePath);
+	assert(expectedHeaders || (numberOfDistributions == 0));
+
+	if ((type != kFloatingPointVariableTypeFloat) && (type != kFloatingPointVariableTypeDouble))
+	{
+		fatal("inputDistributionsType must be specified");
+	}
+
+	fp = (strcmp(inputFilePath, "stdin") == 0) ? stdin : fopen(inputFilePath, "r");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", inputFilePath);
+
+		return NULL;
+	}
+
+	tail = (CSVInputTail *)checkedCalloc(1, sizeof(CSVInputTail), __FILE__, __LINE__);
+	*tail = (CSVInputTail) {
+		.fp = fp,
+		.expectedHeaders = expectedHeaders,
+		.isProjection = isProjection,
+		.numberOfDistributions = numberOfDistributions,
+		.layout = {
+			.numberOfFields = numberOfDistributions,
+			.fieldColumns = NULL,
+		},
+		.uxColumns = (bool *)checkedCalloc(numberOfDistributions, sizeof(bool), __FILE__, __LINE__),
+	};
+	initSampleColumns(&tail->columns, type, numberOfDistributions, 1);
+
+	return tail;
+}
+
+CommonConstantReturnType
+updateCSVInputTail(
+	CSVInputTail *	tail,
+	void *		inputDistributions,
+	size_t *	numberOfNewRows)
+{
+	CSVParseError	parseError;
+	const char *	cursor;
+	const char *	parseEnd;
+	int64_t		rowCount = 0;
+	size_t		bytesRead;
+
+	assert(inputDistributions || (tail->numberOfDistributions == 0));
+
+	if (numberOfNewRows != NULL)
+	{
+		*numberOfNewRows = 0;
+	}
+
+	if (tail->hasFailed)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
+	/*
+	 *	Read everything appended since the last update. Clearing the end-of-file
+	 *	indicator lets the next update read past where this one stopped.
+	 */
+	do
+	{
+		reserveCSVInputStreamBuffer(&tail->buffer, &tail->bufferCapacity, tail->bufferLength + kCSVInputStreamBlockSize + 1);
+		bytesRead = fread(tail->buffer + tail->bufferLength, 1, kCSVInputStreamBlockSize, tail->fp);
+		tail->bufferLength += bytesRead;
+		COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesRead, bytesRead);
+	} while (bytesRead == kCSVInputStreamBlockSize);
+
+	if (ferror(tail->fp))
+	{
+		fprintf(stderr, "Error: Failed to read the input CSV data.\n");
+		tail->hasFailed = true;
+
+		return kCommonConstantReturnTypeError;
+	}
+	clearerr(tail->fp);
+
+	/*
+	 *	Only complete rows are parsed. A row still being written is left in the buffer
+	 *	until its '\n' arrives.
+	 */
+	cursor = tail->buffer;
+	parseEnd = findLastCSVLineEnd(tail->buffer, tail->buffer + tail->bufferLength);
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseInputParsing);
+	if (!tail->isHeaderValidated && (cursor < parseEnd))
+	{
+		const char *	lineEnd = findCSVLineEnd(cursor, parseEnd);
+
+		tail->isHeaderValidated = true;
+		if (readCSVHeader(cursor, lineEnd, tail->expectedHeaders, tail->numberOfDistributions, tail->isProjection, NULL, &tail->layout) != kCommonConstantReturnTypeSuccess)
+		{
+			tail->hasFailed = true;
+		}
+		cursor = lineEnd;
+	}
+
+	if (!tail->hasFailed && (cursor < parseEnd))
+	{
+		reserveSampleColumns(&tail->columns, (size_t)tail->numberOfRows + countCSVLines(cursor, parseEnd));
+		if (parseCSVRows(cursor, parseEnd, (tail->numberOfRows == 0), tail->uxColumns, &tail->layout, &tail->columns, &rowCount, &parseError) != kCommonConstantReturnTypeSuccess)
+		{
+			reportCSVParseError(&parseError, tail->numberOfRows);
+			tail->hasFailed = true;
+		}
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseInputParsing);
+
+	if (tail->hasFailed)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
+	tail->numberOfRows += rowCount;
+	tail->offset += (uint64_t)(parseEnd - tail->buffer);
+	tail->bufferLength -= (size_t)(parseEnd - tail->buffer);
+	memmove(tail->buffer, parseEnd, tail->bufferLength);
+
+	if (rowCount > 0)
+	{
+		getDistributionsFromSampleColumns(&tail->columns, tail->uxColumns, inputDistributions);
+	}
+
+	if (numberOfNewRows != NULL)
+	{
+		*numberOfNewRows = (size_t)rowCount;
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+uint64_t
+getCSVInputTailOffset(const CSVInputTail *  tail)
+{
+	return tail->offset;
+}
+
+void
+closeCSVInputTail(CSVInputTail *  tail)
+{
+	if (tail == NULL)
+	{
+		return;
+	}
+
+	if (tail->fp != stdin)
+	{
+		fclose(tail->fp);
+	}
+	freeSampleColumns(&tail->columns);
+	freeCSVRowLayout(&tail->layout);
+	free(tail->uxColumns);
+	free(tail->buffer);
+	free(tail);
+}
+
+/*
+ *	Growable text buffer, so that output is formatted in memory and written at once.
+ */
+typedef struct
+{
+	char *	data;
+	size_t	size;
+	size_t	capacity;
+} OutputBuffer;
+
+enum
+{
+	/*
+	 *	Longest output of "%f" for a double: 309 integer digits, the sign, the point
+	 *	and 6 decimals.
+	 */
+	kOutputBufferMaxCharsPerFixed	= 320,
+};
+
+static void
+reserveOutputBuffer(OutputBuffer *  buffer, size_t  additionalSize)
+{
+	size_t	newCapacity = buffer->capacity;
+	char *	data;
+
+	if (additionalSize <= buffer->capacity - buffer->size)
+	{
+		return;
+	}
+
+	if (additionalSize > SIZE_MAX / 2 - buffer->size)
+	{
+		fatal("Output buffer of %zu bytes overflows at %s:%d", buffer->size, __FILE__, __LINE__);
+	}
+
+	newCapacity = (newCapacity > 0) ? newCapacity : 4096;
+	while (newCapacity < buffer->size + additionalSize)
+	{
+		newCapacity *= 2;
+	}
+
+	data = (char *)realloc(buffer->data, newCapacity);
+	if (data == NULL)
+	{
+		fatal("realloc() failed to allocate %zu bytes at %s:%d", newCapacity, __FILE__, __LINE__);
+	}
+
+	buffer->data = data;
+	buffer->capacity = newCapacity;
+}
+
+static void
+appendOutputBufferBytes(OutputBuffer *  buffer, const char *  bytes, size_t  size)
+{
+	reserveOutputBuffer(buffer, size);
+	memcpy(buffer->data + buffer->size, bytes, size);
+	buffer->size += size;
+}
+
+static void
+appendOutputBufferString(OutputBuffer *  buffer, const char *  string)
+{
+	appendOutputBufferBytes(buffer, string, strlen(string));
+}
+
+static void
+appendOutputBufferFormat(OutputBuffer *  buffer, const char *  format, ...)
+	__attribute__ ((format (printf, 2, 3)));
+
+static void
+appendOutputBufferFormat(OutputBuffer *  buffer, const char *  format, ...)
+{
+	va_list	arguments;
+	int	length;
+
+	reserveOutputBuffer(buffer, kOutputBufferMaxCharsPerFixed);
+
+	va_start(arguments, format);
+	length = vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, format, arguments);
+	va_end(arguments);
+
+	if (length < 0)
+	{
+		fatal("vsnprintf() failed at %s:%d", __FILE__, __LINE__);
+	}
+
+	if ((size_t)length >= buffer->capacity - buffer->size)
+	{
+		reserveOutputBuffer(buffer, (size_t)length + 1);
+
+		va_start(arguments, format);
+		vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, format, arguments);
+		va_end(arguments);
+	}
+
+	buffer->size += (size_t)length;
+}
+
+/*
+ *	Append `value` exactly as `printf()` formats it with "%f", or with "% f" if
+ *	`hasSpaceSign` is set. Finite values below 2^43 in magnitude are rounded
+ *	(to nearest, ties to even) from their exact binary value without going through
+ *	`printf()`, everything else is left to libc. Only for point values: on Signaloid
+ *	processors `printf()` formats a distributional value as its Ux string, and this
+ *	would format its mean.
+ */
+static void
+appendOutputBufferFixed(OutputBuffer *  buffer, double  value, bool  hasSpaceSign)
+{
+#ifdef __SIZEOF_INT128__
+	uint64_t	bits;
+	uint64_t	mantissa;
+	int		exponent;
+	int		shift;
+	uint64_t	scaled;
+	uint64_t	integerPart;
+	uint64_t	fractionPart;
+	char		digits[24];
+	char *		cursor = digits + sizeof(digits);
+	char		sign;
+
+	memcpy(&bits, &value, sizeof(bits));
+	exponent = (int)((bits >> 52) & 0x7ff);
+	mantissa = bits & ((UINT64_C(1) << 52) - 1);
+
+	if (exponent < 0x3ff + 43)
+	{
+		if (exponent == 0)
+		{
+			exponent = 1;
+		}
+		else
+		{
+			mantissa |= UINT64_C(1) << 52;
+		}
+
+		/*
+		 *	|value| * 10^6 = mantissa * 10^6 / 2^shift, with shift > 9.
+		 */
+		shift = 0x3ff + 52 - exponent;
+		if (shift >= 74)
+		{
+			scaled = 0;
+		}
+		else
+		{
+			__uint128_t	product = (__uint128_t)mantissa * 1000000;
+			__uint128_t	remainder = product & ((((__uint128_t)1) << shift) - 1);
+			__uint128_t	half = ((__uint128_t)1) << (shift - 1);
+
+			scaled = (uint64_t)(product >> shift);
+			if ((remainder > half) || ((remainder == half) && ((scaled & 1) != 0)))
+			{
+				scaled++;
+			}
+		}
+
+		integerPart = scaled / 1000000;
+		fractionPart = scaled % 1000000;
+
+		for (int i = 0; i < 6; i++)
+		{
+			*--cursor = (char)('0' + fractionPart % 10);
+			fractionPart /= 10;
+		}
+		*--cursor = '.';
+		do
+		{
+			*--cursor = (char)('0' + integerPart % 10);
+			integerPart /= 10;
+		} while (integerPart != 0);
+
+		sign = ((bits >> 63) != 0) ? '-' : (hasSpaceSign ? ' ' : '\0');
+		if (sign != '\0')
+		{
+			*--cursor = sign;
+		}
+
+		appendOutputBufferBytes(buffer, cursor, (size_t)(digits + sizeof(digits) - cursor));
+
+		return;
+	}
+#endif /* __SIZEOF_INT128__ */
+
+	appendOutputBufferFormat(buffer, hasSpaceSign ? "% f" : "%f", value);
+}
+
+static void
+freeOutputBuffer(OutputBuffer *  buffer)
+{
+	free(buffer->data);
+	*buffer = (OutputBuffer) { ZERO_STRUCT_INIT };
+}
+
+/*
+ *	Output sinks. A sink collects the output of one file in memory pages of about
+ *	`kOutputSinkPageSize` bytes. Where POSIX threads exist, full pages are written,
+ *	and the file is synced and closed, by a background writer thread while the
+ *	caller goes on filling the other page. `flushOutputSinks()` waits for all of that
+ *	to finish. The standard output is always written on the calling thread, so that
+ *	it stays in order with the caller's own output.
+ */
+enum
+{
+	kOutputSinkPageSize	= 1024 * 1024,
+	kOutputSinkMaxPatchSize	= 32,
+};
+
+typedef struct OutputSink
+{
+	FILE *			fp;
+	char			path[kCommonConstantMaxCharsPerFilepath];
+	bool			isAsynchronous;
+	OutputBuffer		pages[2];
+	size_t			currentPage;
+	bool			isPageInFlight;
+	bool			isCloseRequested;
+	bool			hasFailed;
+	char			patch[kOutputSinkMaxPatchSize];
+	size_t			patchSize;
+	long			patchOffset;
+	struct OutputSink *	nextInQueue;
+} OutputSink;
+
+typedef struct
+{
+	OutputSink *		queueHead;
+	OutputSink *		queueTail;
+	size_t			numberOfClosingSinks;
+	bool			hasFailed;
+#ifdef COMMON_HAVE_PTHREADS
+	pthread_mutex_t		mutex;
+	pthread_cond_t		workAvailable;
+	pthread_cond_t		workDone;
+	pthread_t		thread;
+	bool			isThreadStarted;
+	bool			isShutdownRequested;
+#endif /* COMMON_HAVE_PTHREADS */
+} OutputSinkWriter;
+
+static OutputSinkWriter	outputSinkWriter = {
+#ifdef COMMON_HAVE_PTHREADS
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.workAvailable = PTHREAD_COND_INITIALIZER,
+	.workDone = PTHREAD_COND_INITIALIZER,
+#else
+	.queueHead = NULL,
+#endif /* COMMON_HAVE_PTHREADS */
+};
+
+/*
+ *	Write `page` of `sink` and, if it has been asked for, close the file. Returns
+ *	false on failure.
+ */
+static bool
+writeOutputSinkPage(OutputSink *  sink, const OutputBuffer *  page, bool  isClose)
+{
+	bool	isWriteOk = (fwrite(page->data, 1, page->size, sink->fp) == page->size);
+
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterOutputBytes, page->size);
+
+	if (!isClose)
+	{
+		return isWriteOk;
+	}
+
+	if (sink->fp == stdout)
+	{
+		return isWriteOk;
+	}
+
+	if (sink->patchSize > 0)
+	{
+		isWriteOk = isWriteOk
+				&& (fseek(sink->fp, sink->patchOffset, SEEK_SET) == 0)
+				&& (fwrite(sink->patch, 1, sink->patchSize, sink->fp) == sink->patchSize);
+	}
+
+	isWriteOk = (fflush(sink->fp) == 0) && isWriteOk;
+#ifdef COMMON_HAVE_FSYNC
+	isWriteOk = (fsync(fileno(sink->fp)) == 0) && isWriteOk;
+#endif /* COMMON_HAVE_FSYNC */
+	isWriteOk = (fclose(sink->fp) == 0) && isWriteOk;
+
+	return isWriteOk;
+}
+
+/*
+ *	Free `sink` once its file is closed. Called with the writer's mutex held.
+ */
+static void
+freeOutputSink(OutputSink *  sink)
+{
+	if (sink->hasFailed)
+	{
+		fprintf(stderr, "Error: Cannot write the file %s.\n", sink->path);
+		outputSinkWriter.hasFailed = true;
+	}
+
+	freeOutputBuffer(&sink->pages[0]);
+	freeOutputBuffer(&sink->pages[1]);
+	free(sink);
+}
+
+#ifdef COMMON_HAVE_PTHREADS
+static void *
+runOutputSinkWriter(void *  argument)
+{
+	OutputSinkWriter *	writer = (OutputSinkWriter *)argument;
+	OutputSink *		sink;
+	bool			isClose;
+	bool			isWriteOk;
+
+	pthread_mutex_lock(&writer->mutex);
+	for (;;)
+	{
+		while ((writer->queueHead == NULL) && !writer->isShutdownRequested)
+		{
+			pthread_cond_wait(&writer->workAvailable, &writer->mutex);
+		}
+
+		if (writer->queueHead == NULL)
+		{
+			break;
+		}
+
+		sink = writer->queueHead;
+		writer->queueHead = sink->nextInQueue;
+		if (writer->queueHead == NULL)
+		{
+			writer->queueTail = NULL;
+		}
+		isClose = sink->isCloseRequested;
+
+		/*
+		 *	The page in flight is not touched by the producer until it is released below.
+		 */
+		pthread_mutex_unlock(&writer->mutex);
+		isWriteOk = writeOutputSinkPage(sink, &sink->pages[1 - sink->currentPage], isClose);
+		pthread_mutex_lock(&writer->mutex);
+
+		sink->pages[1 - sink->currentPage].size = 0;
+		sink->hasFailed = sink->hasFailed || !isWriteOk;
+		sink->isPageInFlight = false;
+		if (isClose)
+		{
+			freeOutputSink(sink);
+			writer->numberOfClosingSinks--;
+		}
+		pthread_cond_broadcast(&writer->workDone);
+	}
+	pthread_mutex_unlock(&writer->mutex);
+
+	return NULL;
+}
+
+static void
+flushOutputSinksAtExit(void)
+{
+	flushOutputSinks();
+}
+
+/*
+ *	Start the writer thread if it is not running. Called with the writer's mutex
+ *	held. Returns false if there is no writer thread.
+ */
+static bool
+startOutputSinkWriter(OutputSinkWriter *  writer)
+{
+	static bool	isExitHandlerRegistered = false;
+
+	if (!writer->isThreadStarted)
+	{
+		/*
+		 *	Pending output is not lost if the program exits without flushing.
+		 */
+		if (!isExitHandlerRegistered)
+		{
+			isExitHandlerRegistered = (atexit(flushOutputSinksAtExit) == 0);
+		}
+
+		writer->isShutdownRequested = false;
+		writer->isThreadStarted = (pthread_create(&writer->thread, NULL, runOutputSinkWriter, writer) == 0);
+	}
+
+	return writer->isThreadStarted;
+}
+#endif /* COMMON_HAVE_PTHREADS */
+
+/*
+ *	Open `outputFilePath` (or the standard output for `NULL`) with `fopen()` mode
+ *	`mode`. Returns `NULL` if the file cannot be opened.
+ */
+static OutputSink *
+openOutputSink(const char *  outputFilePath, const char *  mode)
+{
+	OutputSink *	sink = (OutputSink *)checkedCalloc(1, sizeof(OutputSink), __FILE__, __LINE__);
+
+	sink->fp = (outputFilePath != NULL) ? fopen(outputFilePath, mode) : stdout;
+	if (sink->fp == NULL)
+	{
+		free(sink);
+
+		return NULL;
+	}
+
+	snprintf(sink->path, sizeof(sink->path), "%s", (outputFilePath != NULL) ? outputFilePath : "stdout");
+	sink->isAsynchronous = (sink->fp != stdout);
+
+	return sink;
+}
+
+static OutputBuffer *
+getOutputSinkBuffer(OutputSink *  sink)
+{
+	return &sink->pages[sink->currentPage];
+}
+
+/*
+ *	Hand the current page of `sink` to the writer and switch to the other page,
+ *	waiting for that one if it is still being written. On close, `sink` is freed.
+ */
+static void
+submitOutputSinkPage(OutputSink *  sink, bool  isClose)
+{
+#ifdef COMMON_HAVE_PTHREADS
+	OutputSinkWriter *	writer = &outputSinkWriter;
+
+	if (sink->isAsynchronous)
+	{
+		pthread_mutex_lock(&writer->mutex);
+		if (startOutputSinkWriter(writer))
+		{
+			while (sink->isPageInFlight)
+			{
+				pthread_cond_wait(&writer->workDone, &writer->mutex);
+			}
+
+			sink->currentPage = 1 - sink->currentPage;
+			sink->isPageInFlight = true;
+			sink->isCloseRequested = isClose;
+			sink->nextInQueue = NULL;
+			if (writer->queueTail != NULL)
+			{
+				writer->queueTail->nextInQueue = sink;
+			}
+			else
+			{
+				writer->queueHead = sink;
+			}
+			writer->queueTail = sink;
+			writer->numberOfClosingSinks += isClose ? 1 : 0;
+			pthread_cond_signal(&writer->workAvailable);
+			pthread_mutex_unlock(&writer->mutex);
+
+			return;
+		}
+		pthread_mutex_unlock(&writer->mutex);
+	}
+#endif /* COMMON_HAVE_PTHREADS */
+
+	/*
+	 *	Without a writer thread the page is written right away.
+	 */
+	sink->hasFailed = !writeOutputSinkPage(sink, getOutputSinkBuffer(sink), isClose) || sink->hasFailed;
+	getOutputSinkBuffer(sink)->size = 0;
+	if (isClose)
+	{
+#ifdef COMMON_HAVE_PTHREADS
+		pthread_mutex_lock(&outputSinkWriter.mutex);
+		freeOutputSink(sink);
+		pthread_mutex_unlock(&outputSinkWriter.mutex);
+#else
+		freeOutputSink(sink);
+#endif /* COMMON_HAVE_PTHREADS */
+	}
+}
+
+/*
+ *	Submit the current page of `sink` once it is full. Call after appending to
+ *	`getOutputSinkBuffer(sink)`.
+ */
+static void
+commitOutputSink(OutputSink *  sink)
+{
+	if (getOutputSinkBuffer(sink)->size >= kOutputSinkPageSize)
+	{
+		submitOutputSinkPage(sink, false);
+	}
+}
+
+static void
+appendOutputSinkBytes(OutputSink *  sink, const void *  bytes, size_t  size)
+{
+	while (size > 0)
+	{
+		OutputBuffer *	page = getOutputSinkBuffer(sink);
+		size_t		chunkSize = (page->size < kOutputSinkPageSize) ? kOutputSinkPageSize - page->size : 0;
+
+		chunkSize = (chunkSize < size) ? chunkSize : size;
+		appendOutputBufferBytes(page, (const char *)bytes, chunkSize);
+		bytes = (const char *)bytes + chunkSize;
+		size -= chunkSize;
+		commitOutputSink(sink);
+	}
+}
+
+/*
+ *	Overwrite `size` bytes at `offset` in the file of `sink` with `bytes` just before
+ *	the file is closed, for headers whose contents are only known at the end. The
+ *	file must be seekable.
+ */
+static void
+setOutputSinkPatch(OutputSink *  sink, long  offset, const void *  bytes, size_t  size)
+{
+	assert(size <= sizeof(sink->patch));
+
+	memcpy(sink->patch, bytes, size);
+	sink->patchSize = size;
+	sink->patchOffset = offset;
+}
+
+/*
+ *	Write out what is left of `sink` and close it. The file is closed, and `sink`
+ *	freed, in the background. Errors are reported by `flushOutputSinks()`.
+ */
+static void
+closeOutputSink(OutputSink *  sink)
+{
+	submitOutputSinkPage(sink, true);
+}
+
+CommonConstantReturnType
+flushOutputSinks(void)
+{
+	OutputSinkWriter *	writer = &outputSinkWriter;
+	bool			hasFailed;
+
+#ifdef COMMON_HAVE_PTHREADS
+	pthread_mutex_lock(&writer->mutex);
+	while (writer->numberOfClosingSinks > 0)
+	{
+		pthread_cond_wait(&writer->workDone, &writer->mutex);
+	}
+
+	if (writer->isThreadStarted)
+	{
+		writer->isShutdownRequested = true;
+		pthread_cond_signal(&writer->workAvailable);
+		pthread_mutex_unlock(&writer->mutex);
+		pthread_join(writer->thread, NULL);
+		pthread_mutex_lock(&writer->mutex);
+		writer->isThreadStarted = false;
+	}
+	hasFailed = writer->hasFailed;
+	writer->hasFailed = false;
+	pthread_mutex_unlock(&writer->mutex);
+#else
+	hasFailed = writer->hasFailed;
+	writer->hasFailed = false;
+#endif /* COMMON_HAVE_PTHREADS */
+
+	return hasFailed ? kCommonConstantReturnTypeError : kCommonConstantReturnTypeSuccess;
+}
+
+CommonConstantReturnType
+writeOutputFloatDistributionsToCSV(
+	const char *		outputFilePath,
+	const float *		outputVariables,
+	const char * const *	outputVariableNames,
+	size_t			numberOfOutputDistributions)
+{
+	CommonConstantReturnType	returnCode;
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseOutput);
+	returnCode = writeOutputDistributionsToCSV(
+				outputFilePath,
+				(const void *) outputVariables,
+				kFloatingPointVariableTypeFloat,
+				outputVariableNames,
+				numberOfOutputDistributions);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseOutput);
+
+	return returnCode;
+}
+
+CommonConstantReturnType
+writeOutputDoubleDistributionsToCSV(
+	const char *		outputFilePath,
+	const double *		outputVariables,
+	const char * const *	outputVariableNames,
+	size_t			numberOfOutputDistributions)
+{
+	CommonConstantReturnType	returnCode;
+
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseOutput);
+	returnCode = writeOutputDistributionsToCSV(
+				outputFilePath,
+				(const void *) outputVariables,
+				kFloatingPointVariableTypeDouble,
+				outputVariableNames,
+				numberOfOutputDistributions);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseOutput);
+
+	return returnCode;
+}
+
+CommonConstantReturnType
+writeOutputDistributionsToCSV(
+	const char *			outputFilePath,
+	const void *			outputVariables,
+	FloatingPointVariableType	outputVariablesType,
+	const char * const *		outputVariableNames,
+	size_t				numberOfOutputDistributions)
+{
+	OutputSink *	sink = NULL;
+	OutputBuffer *	buffer;
+	float *		outputFloatVariables;
+	double *	outputDoubleVariables;
+
+	sink = openOutputSink(strcmp(outputFilePath, "stdout") ? outputFilePath : NULL, "w");
+	if (sink == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the file %s.\n", outputFilePath);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	for (size_t i = 0; i < numberOfOutputDistributions; i++)
+	{
+		buffer = getOutputSinkBuffer(sink);
+		appendOutputBufferString(buffer, outputVariableNames[i]);
+		if (i != numberOfOutputDistributions - 1)
+		{
+			appendOutputBufferString(buffer, ", ");
+		}
+		commitOutputSink(sink);
+	}
+	appendOutputBufferString(getOutputSinkBuffer(sink), "\n");
+
+	switch (outputVariablesType)
+	{
+		case kFloatingPointVariableTypeFloat:
+		{
+			outputFloatVariables = (float *) outputVariables;
+
+			for (size_t i = 0; i < numberOfOutputDistributions; i++)
+			{
+				buffer = getOutputSinkBuffer(sink);
+				appendOutputBufferFormat(buffer, "%e", outputFloatVariables[i]);
+				if (i != numberOfOutputDistributions - 1)
+				{
+					appendOutputBufferString(buffer, ", ");
+				}
+				commitOutputSink(sink);
+			}
+			break;
+		}
+		case kFloatingPointVariableTypeDouble:
+		{
+			outputDoubleVariables = (double *) outputVariables;
+
+			for (size_t i = 0; i < numberOfOutputDistributions; i++)
+			{
+				buffer = getOutputSinkBuffer(sink);
+				appendOutputBufferFormat(buffer, "%le", outputDoubleVariables[i]);
+				if (i != numberOfOutputDistributions - 1)
+				{
+					appendOutputBufferString(buffer, ", ");
+				}
+				commitOutputSink(sink);
+			}
+			break;
+		}
+		case kFloatingPointVariableTypeUnknown:
+		default:
+		{
+			fatal("outputVariablesType must be specified");
+		}
+	}
+	appendOutputBufferString(getOutputSinkBuffer(sink), "\n");
+
+	/*
+	 *	The file is written and closed in the background, see `flushOutputSinks()`.
+	 */
+	closeOutputSink(sink);
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+/*
+ *	Append the JSON values of `jsonVariable`, one per line, or, if `isStdValue`, those
+ *	of their standard deviations instead (except for particles, whose standard
+ *	deviations are `appendJSONParticleStdValues()`). Always inlined with constant
+ *	`isDouble` and `isParticle`, which must match the type of `jsonVariable`, so that
+ *	the type is tested once per variable rather than once per value.
+ */
+static inline __attribute__((always_inline)) void
+appendJSONVariableValuesOfKind(
+	OutputBuffer *		buffer,
+	const JSONVariable *	jsonVariable,
+	bool			isStdValue,
+	bool			isDouble,
+	bool			isParticle)
+{
+	/*
+	 *	With an empty particle modifier, "% " SignaloidParticleModifier "f" is plain "% f".
+	 *	Only the standard deviations, which are point values, are formatted without
+	 *	libc then: on Signaloid processors the values themselves may be distributional,
+	 *	and libc formats those as Ux strings.
+	 */
+	const bool	isParticleModifierEmpty = (sizeof(SignaloidParticleModifier) == 1);
+
+	for (size_t j = 0; j < jsonVariable->size; j++)
+	{
+		double	value = isDouble ? jsonVariable->values.asDouble[j] : jsonVariable->values.asFloat[j];
+
+		if (!isParticle)
+		{
+			if (!isStdValue)
+			{
+				appendOutputBufferFormat(buffer, "\t\t\t\t\"%f\"", value);
+			}
+			else
+			{
+				value = isDouble
+					? UxHwDoubleNthMoment(jsonVariable->values.asDouble[j], 2)
+					: UxHwFloatNthMoment(jsonVariable->values.asFloat[j], 2);
+				if (isParticleModifierEmpty)
+				{
+					appendOutputBufferString(buffer, "\t\t\t\t");
+					appendOutputBufferFixed(buffer, value, true);
+				}
+				else
+				{
+					appendOutputBufferFormat(buffer, "\t\t\t\t% " SignaloidParticleModifier "f", value);
+				}
+			}
+		}
+		else
+		{
+			assert(!isStdValue);
+			appendOutputBufferFormat(buffer, "\t\t\t\t\"% " SignaloidParticleModifier "f\"", value);
+		}
+
+		appendOutputBufferString(buffer, (j < (jsonVariable->size - 1)) ? ", \n" : "\n");
+	}
+}
+
+/*
+ *	Append the `size` standard deviations of a particle variable. They are all zero,
+ *	so the first is formatted and the others are copies of it.
+ */
+static void
+appendJSONParticleStdValues(OutputBuffer *  buffer, size_t  size)
+{
+	const bool	isParticleModifierEmpty = (sizeof(SignaloidParticleModifier) == 1);
+	const size_t	separatorLength = strlen(", \n");
+	size_t		entryStart = buffer->size;
+	size_t		entrySize;
+
+	if (size == 0)
+	{
+		return;
+	}
+
+	if (isParticleModifierEmpty)
+	{
+		appendOutputBufferString(buffer, "\t\t\t\t");
+		appendOutputBufferFixed(buffer, 0.0, true);
+	}
+	else
+	{
+		appendOutputBufferFormat(buffer, "\t\t\t\t% " SignaloidParticleModifier "f", 0.0);
+	}
+	appendOutputBufferString(buffer, ", \n");
+
+	entrySize = buffer->size - entryStart;
+	reserveOutputBuffer(buffer, entrySize * (size - 1));
+	for (size_t j = 1; j < size; j++)
+	{
+		memcpy(buffer->data + buffer->size, buffer->data + entryStart, entrySize);
+		buffer->size += entrySize;
+	}
+
+	/*
+	 *	The last entry is followed by a newline only.
+	 */
+	buffer->size -= separatorLength;
+	appendOutputBufferString(buffer, "\n");
+}
+
+/*
+ *	Append the values of the particle variable `jsonVariable` as base64 of their
+ *	little-endian IEEE 754 bytes, see `setJSONParticleEncoding()`. The values are
+ *	staged in blocks whose size is a multiple of 3, so only the last block is padded.
+ */
+static void
+appendJSONParticleValuesBase64(OutputBuffer *  buffer, const JSONVariable *  jsonVariable)
+{
+	static const char	kBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	const bool		isDouble = (jsonVariable->type == kJSONVariableTypeDoubleParticle);
+	const size_t		valueSize = isDouble ? sizeof(uint64_t) : sizeof(uint32_t);
+	char			staged[3 * 256];
+	size_t			valuesPerBlock = sizeof(staged) / valueSize;
+
+	reserveOutputBuffer(buffer, 4 * ((jsonVariable->size * valueSize + 2) / 3));
+	for (size_t first = 0; first < jsonVariable->size; first += valuesPerBlock)
+	{
+		size_t		count = (jsonVariable->size - first < valuesPerBlock) ? jsonVariable->size - first : valuesPerBlock;
+		size_t		stagedSize = count * valueSize;
+		char *		out = buffer->data + buffer->size;
+		size_t		i = 0;
+
+		for (size_t j = 0; j < count; j++)
+		{
+			if (isDouble)
+			{
+				uint64_t	bits;
+
+				memcpy(&bits, &jsonVariable->values.asDouble[first + j], sizeof(bits));
+				storeLittleEndian64(staged + j * sizeof(bits), bits);
+			}
+			else
+			{
+				uint32_t	bits;
+
+				memcpy(&bits, &jsonVariable->values.asFloat[first + j], sizeof(bits));
+				storeLittleEndian32(staged + j * sizeof(bits), bits);
+			}
+		}
+
+		for (; i + 3 <= stagedSize; i += 3)
+		{
+			uint32_t	triple = ((uint32_t)(uint8_t)staged[i] << 16) | ((uint32_t)(uint8_t)staged[i + 1] << 8) | (uint8_t)staged[i + 2];
+
+			*out++ = kBase64Alphabet[(triple >> 18) & 0x3F];
+			*out++ = kBase64Alphabet[(triple >> 12) & 0x3F];
+			*out++ = kBase64Alphabet[(triple >> 6) & 0x3F];
+			*out++ = kBase64Alphabet[triple & 0x3F];
+		}
+
+		if (i < stagedSize)
+		{
+			uint32_t	triple = (uint32_t)(uint8_t)staged[i] << 16;
+
+			if (i + 1 < stagedSize)
+			{
+				triple |= (uint32_t)(uint8_t)staged[i + 1] << 8;
+			}
+			*out++ = kBase64Alphabet[(triple >> 18) & 0x3F];
+			*out++ = kBase64Alphabet[(triple >> 12) & 0x3F];
+			*out++ = (i + 1 < stagedSize) ? kBase64Alphabet[(triple >> 6) & 0x3F] : '=';
+			*out++ = '=';
+		}
+
+		buffer->size = (size_t)(out - buffer->data);
+	}
+}
+
+static void
+appendJSONVariableValues(OutputBuffer *  buffer, const JSONVariable *  jsonVariable, bool  isStdValue)
+{
+	switch (jsonVariable->type)
+	{
+		case kJSONVariableTypeDouble:
+		{
+			appendJSONVariableValuesOfKind(buffer, jsonVariable, isStdValue, true, false);
+			break;
+		}
+		case kJSONVariableTypeFloat:
+		{
+			appendJSONVariableValuesOfKind(buffer, jsonVariable, isStdValue, false, false);
+			break;
+		}
+		case kJSONVariableTypeDoubleParticle:
+		{
+			if (isStdValue)
+			{
+				appendJSONParticleStdValues(buffer, jsonVariable->size);
+			}
+			else
+			{
+				appendJSONVariableValuesOfKind(buffer, jsonVariable, false, true, true);
+			}
+			break;
+		}
+		case kJSONVariableTypeFloatParticle:
+		{
+			if (isStdValue)
+			{
+				appendJSONParticleStdValues(buffer, jsonVariable->size);
+			}
+			else
+			{
+				appendJSONVariableValuesOfKind(buffer, jsonVariable, false, false, true);
+			}
+			break;
+		}
+		case kJSONVariableTypeUnknown:
+		default:
+		{
+			fatal("kJSONVariableTypeUnknown must be specified");
+		}
+	}
+}
+
+/*
+ *	Encoding of particle values in JSON output. See `setJSONParticleEncoding()`.
+ */
+static JSONParticleEncoding	jsonParticleEncoding = kJSONParticleEncodingText;
+
+void
+setJSONParticleEncoding(JSONParticleEncoding  encoding)
+{
+	jsonParticleEncoding = encoding;
+}
+
+static void
+writeJSONVariables(JSONVariable *  jsonVariables, size_t count, const char *  description)
+{
+	OutputSink *	sink = openOutputSink(NULL, "w");
+	OutputBuffer *	buffer = getOutputSinkBuffer(sink);
+	size_t		estimatedSize = 64 + strlen(description);
+
+	/*
+	 *	Format the whole JSON document in memory and write it with a single call. The
+	 *	standard output sink is written synchronously, so the page stays valid.
+	 */
+	for (size_t i = 0; i < count; i++)
+	{
+		estimatedSize += 256 + 2 * strlen(jsonVariables[i].variableSymbol) + strlen(jsonVariables[i].variableDescription) + 48 * jsonVariables[i].size;
+	}
+	reserveOutputBuffer(buffer, estimatedSize);
+
+	appendOutputBufferString(buffer, "{\n");
+	appendOutputBufferString(buffer, "\t\"description\": \"");
+	appendOutputBufferString(buffer, description);
+	appendOutputBufferString(buffer, "\",\n");
+	appendOutputBufferString(buffer, "\t\"plots\": [\n");
+
+	for (size_t i = 0; i < count; i++)
+	{
+		appendOutputBufferString(buffer, "\t\t{\n");
+
+		/*
+		 *	We include this property in the JSON for backwards compatibility.
+		 */
+		appendOutputBufferString(buffer, "\t\t\t\"variableID\": \"");
+		appendOutputBufferString(buffer, jsonVariables[i].variableSymbol);
+		appendOutputBufferString(buffer, "\",\n");
+		appendOutputBufferString(buffer, "\t\t\t\"variableSymbol\": \"");
+		appendOutputBufferString(buffer, jsonVariables[i].variableSymbol);
+		appendOutputBufferString(buffer, "\",\n");
+		appendOutputBufferString(buffer, "\t\t\t\"variableDescription\": \"");
+		appendOutputBufferString(buffer, jsonVariables[i].variableDescription);
+		appendOutputBufferString(buffer, "\",\n");
+
+		if ((jsonParticleEncoding == kJSONParticleEncodingBase64) &&
+			((jsonVariables[i].type == kJSONVariableTypeFloatParticle) || (jsonVariables[i].type == kJSONVariableTypeDoubleParticle)))
+		{
+			appendOutputBufferString(buffer, "\t\t\t\"valuesEncoding\": \"");
+			appendOutputBufferString(buffer, (jsonVariables[i].type == kJSONVariableTypeDoubleParticle) ? "base64-float64le" : "base64-float32le");
+			appendOutputBufferString(buffer, "\",\n");
+
+			appendOutputBufferString(buffer, "\t\t\t\"values\": \"");
+			appendJSONParticleValuesBase64(buffer, &jsonVariables[i]);
+			appendOutputBufferString(buffer, "\"\n");
+		}
+		else
+		{
+			appendOutputBufferString(buffer, "\t\t\t\"values\": [\n");
+			appendJSONVariableValues(buffer, &jsonVariables[i], false);
+			appendOutputBufferString(buffer, "\t\t\t],\n");
+
+			appendOutputBufferString(buffer, "\t\t\t\"stdValues\": [\n");
+			appendJSONVariableValues(buffer, &jsonVariables[i], true);
+			appendOutputBufferString(buffer, "\t\t\t]\n");
+		}
+
+		appendOutputBufferString(buffer, (i < count - 1) ? "\t\t},\n" : "\t\t}\n");
+	}
+
+	appendOutputBufferString(buffer, "\t]\n");
+	appendOutputBufferString(buffer, "}\n");
+
+	closeOutputSink(sink);
+}
+
+void
+printJSONVariables(JSONVariable *  jsonVariables, size_t count, const char *  description)
+{
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseOutput);
+	writeJSONVariables(jsonVariables, count, description);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseOutput);
+}
+
+/*
+ *	Where and how `saveMonteCarloFloatDataToDataDotOutFile()` and
+ *	`saveMonteCarloDoubleDataToDataDotOutFile()` write their samples. See
+ *	`setMonteCarloOutput()`.
+ */
+static char			monteCarloOutputFilePath[kCommonConstantMaxCharsPerFilepath] = "data.out";
+static MonteCarloOutputFormat	monteCarloOutputFormat = kMonteCarloOutputFormatText;
+
+void
+setMonteCarloOutput(const char *  outputFilePath, MonteCarloOutputFormat  format)
+{
+	int	ret;
+
+	if (outputFilePath != NULL)
+	{
+		ret = snprintf(monteCarloOutputFilePath, sizeof(monteCarloOutputFilePath), "%s", outputFilePath);
+		if ((ret < 0) || (ret >= (int)sizeof(monteCarloOutputFilePath)))
+		{
+			fatal("Monte Carlo output file path is too long");
+		}
+	}
+
+	monteCarloOutputFormat = format;
+}
+
+static void
+setDefaultCommandLineArgumentValues(CommonCommandLineArguments *  arguments)
+{
+	assert(arguments != NULL);
+
+	*arguments = (CommonCommandLineArguments) {
+							.outputFilePath			= "",
+							.inputFilePath			= "",
+							.inputFilePaths			= NULL,
+							.numberOfInputFiles		= 0,
+							.inputCacheDirectoryPath	= "",
+							.isInputCacheEnabled		= false,
+							.numberOfThreads		= 1,
+							.isWriteToFileEnabled		= false,
+							.isTimingEnabled		= false,
+							.numberOfMonteCarloIterations	= 1,
+							.outputSelect			= 0,
+							.isOutputSelected		= false,
+							.isVerbose			= false,
+							.isInputFromFileEnabled		= false,
+							.isOutputJSONMode		= false,
+							.isHelpEnabled			= false,
+							.isBenchmarkingMode		= false,
+							.isMonteCarloMode		= false,
+							.isSingleShotExecution		= true,
+						};
+
+	/*
+	 *	Start from the current library settings, so that those no option overrides are
+	 *	kept.
+	 */
+	memcpy(arguments->monteCarloOutputFilePath, monteCarloOutputFilePath, sizeof(arguments->monteCarloOutputFilePath));
+	arguments->monteCarloOutputFormat = monteCarloOutputFormat;
+	arguments->jsonParticleEncoding = jsonParticleEncoding;
+	arguments->sketchSize = csvInputSketchSize;
+	arguments->sketchSeed = csvInputSketchSeed;
+	arguments->isInputPrescanEnabled = isCSVInputPrescanEnabled;
+}
+
+static bool
+getOptIsNewlib(void)
+{
+#ifdef _NEWLIB_VERSION
+	return true;
+#endif
+#ifdef MOCK_NEWLIB_VERSION
+	return true;
+#endif
+	return false;
+}
+
+/*
+ *	In every other POSIX libc `getopt_long_only` parses long options starting with "-" (as well
+ *	 as "--"). However, newlibc's `getopt_long_only` (inexplicably) requires long options to
+ *	 start with either "+" or "--". From the source:
+ *
+ *	> The function getopt_long_only() is identical to getopt_long(), except that a plus sign `+'
+ *	> can introduce long options as well as `--'.
+ *
+ *	We work around this inconsistency by transforming options before `getopt_long_only` parses
+ *	them to convert a single leading '-' into a '+'
+ */
+static void
+modifyNextArgvForNewLibc(char * const  argv[])
+{
+	if (getOptIsNewlib())
+	{
+		char *	arg = argv[optind == 0 ? 1 : optind];
+
+		if ((arg != NULL) && (arg[0] == '-') && (arg[1] != '-'))
+		{
+			arg[0] = '+';
+		}
+	}
+}
+
+/*
+ *	The long options for `parseArgs()`: those of the demo, with values from 0, then the
+ *	common ones, with their perfect hash. They are built and checked on the first parse
+ *	and kept while the demo options stay the same, which `isDemoOptionTableCurrent()`
+ *	checks. `arguments` and `expandedArguments` hold the `argv` of the last parse, as
+ *	`expandAbbreviatedArguments()` rewrote it.
+ */
+struct DemoOptionTable
+{
+	DemoOption *		demoSpecificOptions;
+	size_t			numberOfDemoSpecificOptions;
+	size_t			numberOfCommonOptions;
+	int			firstUnabbreviatedValue;
+	struct option *		longOptions;
+	const struct option **	longOptionSlots;
+	size_t			numberOfLongOptionSlots;
+	uint64_t		longOptionHashSeed;
+	char **			arguments;
+	size_t			argumentsCapacity;
+	char **			expandedArguments;
+	size_t			numberOfExpandedArguments;
+	size_t			expandedArgumentsCapacity;
+};
+
+static uint64_t
+hashLongOptionName(uint64_t  seed, const char *  name, size_t  nameLength)
+{
+	return hashBytesFNV1a(UINT64_C(0xcbf29ce484222325) ^ seed, name, nameLength);
+}
+
+/*
+ *	Perfect-hash the `numberOfLongOptions` long options of `table` by name into
+ *	`table->longOptionSlots`: the FNV-1a seed is changed (and the slots grown) until every
+ *	name has a slot of its own. Fatal error if two of them share a name.
+ */
+static void
+hashLongOptions(DemoOptionTable *  table, size_t  numberOfLongOptions)
+{
+	size_t			numberOfSlots = 4;
+	const struct option **	slots;
+	bool			isPerfect = false;
+	uint64_t		seed = 0;
+
+	while (numberOfSlots < 2 * numberOfLongOptions)
+	{
+		numberOfSlots *= 2;
+	}
+
+	slots = (const struct option **)checkedMalloc(numberOfSlots * sizeof(struct option *), __FILE__, __LINE__);
+	while (!isPerfect)
+	{
+		for (seed = 0; (seed < 16) && !isPerfect; seed++)
+		{
+			memset(slots, 0, numberOfSlots * sizeof(struct option *));
+			isPerfect = true;
+			for (size_t i = 0; (i < numberOfLongOptions) && isPerfect; i++)
+			{
+				const struct option *	longOption = &table->longOptions[i];
+				uint64_t		hash = hashLongOptionName(seed, longOption->name, strlen(longOption->name));
+				const struct option **	slot = &slots[hash & (numberOfSlots - 1)];
+
+				if (*slot == NULL)
+				{
+					*slot = longOption;
+				}
+				else if (strcmp((*slot)->name, longOption->name) == 0)
+				{
+					fatal("Internal Error: Duplicate option '%s'", longOption->name);
+				}
+				else
+				{
+					isPerfect = false;
+				}
+			}
+		}
+
+		if (!isPerfect)
+		{
+			numberOfSlots *= 2;
+			slots = (const struct option **)realloc(slots, numberOfSlots * sizeof(struct option *));
+			if (slots == NULL)
+			{
+				fatal("realloc() failed to allocate %zu bytes at %s:%d", numberOfSlots * sizeof(struct option *), __FILE__, __LINE__);
+			}
+		}
+	}
+
+	free(table->longOptionSlots);
+	table->longOptionSlots = slots;
+	table->numberOfLongOptionSlots = numberOfSlots;
+	table->longOptionHashSeed = seed - 1;
+}
+
+/*
+ *	The long option named `name` (up to `nameLength`), or `NULL`.
+ */
+static const struct option *
+findLongOption(const DemoOptionTable *  table, const char *  name, size_t  nameLength)
+{
+	uint64_t		hash = hashLongOptionName(table->longOptionHashSeed, name, nameLength);
+	const struct option *	longOption = table->longOptionSlots[hash & (table->numberOfLongOptionSlots - 1)];
+
+	if ((longOption != NULL) && (strncmp(longOption->name, name, nameLength) == 0) && (longOption->name[nameLength] == '\0'))
+	{
+		return longOption;
+	}
+
+	return NULL;
+}
+
+static size_t
+countDemoOptions(const DemoOption *  options)
+{
+	size_t	numberOfOptions = 0;
+
+	while ((options[numberOfOptions].opt != NULL) || (options[numberOfOptions].optAlternative != NULL))
+	{
+		numberOfOptions++;
+	}
+
+	return numberOfOptions;
+}
+
+/*
+ *	Append the long options of `demoOpts` to `optionsOut` from `outIndex`, with values from
+ *	`firstValue`. Returns the index after the last one appended.
+ */
+static size_t
+constructlongOptions(
+	DemoOption *		demoOpts,
+	size_t 			demoOptsSize,
+	int			firstValue,
+	struct option *		optionsOut,
+	size_t			outIndex)
+{
+	for (size_t i = 0; i < demoOptsSize; i++)
+	{
+		int	hasArg = demoOpts[i].hasArg ? required_argument : no_argument;
+		int	val = firstValue + (int)i;
+
+		if ((demoOpts[i].opt == NULL) && (demoOpts[i].optAlternative == NULL))
+		{
+			fatal("Internal Error: Options for demo missing both option names (index %zu).", i);
+		}
+
+		if (demoOpts[i].opt != NULL)
+		{
+			optionsOut[outIndex] = (struct option) {
+				.name = demoOpts[i].opt,
+				.has_arg = hasArg,
+				.flag = NULL,
+				.val = val,
+			};
+			outIndex++;
+		}
+
+		if (demoOpts[i].optAlternative != NULL)
+		{
+			optionsOut[outIndex] = (struct option) {
+				.name = demoOpts[i].optAlternative,
+				.has_arg = hasArg,
+				.flag = NULL,
+				.val = val,
+			};
+			outIndex++;
+		}
+	}
+
+	return outIndex;
+}
+
+/*
+ *	Drop from `longOptions[firstIndex..numberOfLongOptions)` each option with a value of at
+ *	least `firstDroppableValue` whose name one of `longOptions[0..firstIndex)` already has.
+ *	Returns the number of options left.
+ */
+static size_t
+dropShadowedLongOptions(struct option *  longOptions, size_t  firstIndex, size_t  numberOfLongOptions, int  firstDroppableValue)
+{
+	size_t	numberOfKeptOptions = firstIndex;
+
+	for (size_t i = firstIndex; i < numberOfLongOptions; i++)
+	{
+		bool	isShadowed = false;
+
+		for (size_t j = 0; (j < firstIndex) && !isShadowed && (longOptions[i].val >= firstDroppableValue); j++)
+		{
+			isShadowed = (strcmp(longOptions[i].name, longOptions[j].name) == 0);
+		}
+
+		if (!isShadowed)
+		{
+			longOptions[numberOfKeptOptions++] = longOptions[i];
+		}
+	}
+
+	return numberOfKeptOptions;
+}
+
+/*
+ *	The first `numberOfReservedCommonOptions` of `commonOptions` are reserved: a demo option
+ *	with one of their names is a fatal error. A demo option with the name of a later common
+ *	option takes precedence over it, and the later common options are only matched by their
+ *	full names (see `expandAbbreviatedArguments()`), so that adding options to the library
+ *	can break neither a demo option of the same name nor an abbreviation of one.
+ */
+static void
+buildDemoOptionTable(
+	DemoOptionTable *	table,
+	DemoOption *		demoSpecificOptions,
+	DemoOption *		commonOptions,
+	size_t			numberOfReservedCommonOptions)
+{
+	size_t	numberOfDemoLongOptions;
+	size_t	numberOfLongOptions;
+
+	free(table->longOptions);
+	table->demoSpecificOptions = demoSpecificOptions;
+	table->numberOfDemoSpecificOptions = countDemoOptions(demoSpecificOptions);
+	table->numberOfCommonOptions = countDemoOptions(commonOptions);
+	assert(table->numberOfDemoSpecificOptions + table->numberOfCommonOptions < INT_MAX);
+	table->firstUnabbreviatedValue = (int)(table->numberOfDemoSpecificOptions + numberOfReservedCommonOptions);
+
+	/*
+	 *	At most two longopt's per option (opt and optAlternative) plus zero entry.
+	 */
+	table->longOptions = (struct option *)checkedCalloc(
+							2 * (table->numberOfDemoSpecificOptions + table->numberOfCommonOptions) + 1,
+							sizeof(struct option),
+							__FILE__,
+							__LINE__);
+
+	numberOfDemoLongOptions = constructlongOptions(demoSpecificOptions, table->numberOfDemoSpecificOptions, 0, table->longOptions, 0);
+	numberOfLongOptions = constructlongOptions(
+							commonOptions,
+							table->numberOfCommonOptions,
+							(int)table->numberOfDemoSpecificOptions,
+							table->longOptions,
+							numberOfDemoLongOptions);
+	numberOfLongOptions = dropShadowedLongOptions(
+							table->longOptions,
+							numberOfDemoLongOptions,
+							numberOfLongOptions,
+							table->firstUnabbreviatedValue);
+	hashLongOptions(table, numberOfLongOptions);
+
+	/*
+	 *	Put the final zero entry in
+	 */
+	table->longOptions[numberOfLongOptions] = (struct option) { ZERO_STRUCT_INIT };
+}
+
+/*
+ *	Whether `table` was built for options with the same names as `demoSpecificOptions`. Only
+ *	the name pointers are compared: the names must outlive the table anyway.
+ */
+static bool
+isDemoOptionTableCurrent(const DemoOptionTable *  table, const DemoOption *  demoSpecificOptions)
+{
+	const struct option *	longOption = table->longOptions;
+
+	if ((longOption == NULL) || (table->demoSpecificOptions != demoSpecificOptions))
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < table->numberOfDemoSpecificOptions; i++)
+	{
+		int	hasArg = demoSpecificOptions[i].hasArg ? required_argument : no_argument;
+
+		if ((demoSpecificOptions[i].opt == NULL) && (demoSpecificOptions[i].optAlternative == NULL))
+		{
+			return false;
+		}
+
+		if (demoSpecificOptions[i].opt != NULL)
+		{
+			if ((longOption->name != demoSpecificOptions[i].opt) || (longOption->has_arg != hasArg))
+			{
+				return false;
+			}
+			longOption++;
+		}
+
+		if (demoSpecificOptions[i].optAlternative != NULL)
+		{
+			if ((longOption->name != demoSpecificOptions[i].optAlternative) || (longOption->has_arg != hasArg))
+			{
+				return false;
+			}
+			longOption++;
+		}
+	}
+
+	return (demoSpecificOptions[table->numberOfDemoSpecificOptions].opt == NULL) &&
+		(demoSpecificOptions[table->numberOfDemoSpecificOptions].optAlternative == NULL);
+}
+
+DemoOptionTable *
+createDemoOptionTable(void)
+{
+	return (DemoOptionTable *)checkedCalloc(1, sizeof(DemoOptionTable), __FILE__, __LINE__);
+}
+
+void
+destroyDemoOptionTable(DemoOptionTable *  optionTable)
+{
+	if (optionTable == NULL)
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < optionTable->numberOfExpandedArguments; i++)
+	{
+		free(optionTable->expandedArguments[i]);
+	}
+	free(optionTable->expandedArguments);
+	free(optionTable->arguments);
+	free(optionTable->longOptionSlots);
+	free(optionTable->longOptions);
+	free(optionTable);
+}
+
+static void
+resetDemoOptionFindings(DemoOption *  options, size_t  optionsSize)
+{
+	for (size_t i = 0; i < optionsSize; ++i)
+	{
+		if (options[i].foundOpt != NULL)
+		{
+			*(options[i].foundOpt) = false;
+		}
+		if (options[i].foundArg != NULL)
+		{
+			*(options[i].foundArg) = NULL;
+		}
+	}
+}
+
+/*
+ *	The option that `name` (up to `nameLength`) abbreviates, from the long options with a
+ *	value below `table->firstUnabbreviatedValue`, or `NULL` if it abbreviates none or
+ *	several of them. Like getopt, several names for the same option are one match.
+ */
+static const struct option *
+findAbbreviatedLongOption(const DemoOptionTable *  table, const char *  name, size_t  nameLength)
+{
+	const struct option *	match = NULL;
+
+	for (const struct option * longOption = table->longOptions; longOption->name != NULL; longOption++)
+	{
+		if ((longOption->val >= table->firstUnabbreviatedValue) || (strncmp(longOption->name, name, nameLength) != 0))
+		{
+			continue;
+		}
+
+		if ((match != NULL) && (match->val != longOption->val))
+		{
+			return NULL;
+		}
+		match = longOption;
+	}
+
+	return match;
+}
+
+/*
+ *	Whether `name` (up to `nameLength`) is a prefix of one of the long options with a value
+ *	of at least `table->firstUnabbreviatedValue`.
+ */
+static bool
+isUnabbreviatedLongOptionPrefix(const DemoOptionTable *  table, const char *  name, size_t  nameLength)
+{
+	for (const struct option * longOption = table->longOptions; longOption->name != NULL; longOption++)
+	{
+		if ((longOption->val >= table->firstUnabbreviatedValue) && (strncmp(longOption->name, name, nameLength) == 0))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void *
+growArray(void *  array, size_t *  capacity, size_t  minimumCapacity, size_t  elementSize)
+{
+	if (*capacity >= minimumCapacity)
+	{
+		return array;
+	}
+
+	*capacity = (minimumCapacity > 2 * *capacity) ? minimumCapacity : 2 * *capacity;
+	array = realloc(array, *capacity * elementSize);
+	if (array == NULL)
+	{
+		fatal("realloc() failed to allocate %zu bytes at %s:%d", *capacity * elementSize, __FILE__, __LINE__);
+	}
+
+	return array;
+}
+
+/*
+ *	`getopt_long_only` accepts any unique prefix of any long option, so every common option
+ *	added to the library would make the prefixes it shares with demo options ambiguous.
+ *	Before parsing, `argv` is therefore copied to `table->arguments` with each argument that
+ *	is not an option name itself but a unique prefix among the demo options and the
+ *	reserved common options replaced with the full name of that option (keeping its dashes
+ *	and any "=value"). Any other prefix of a later common option is an error, so that those
+ *	only match their full names. The new strings belong to `table` and live until the next
+ *	parse with it.
+ */
+static CommonConstantReturnType
+expandAbbreviatedArguments(int  argc, char *  const  argv[], DemoOptionTable *  table)
+{
+	for (size_t i = 0; i < table->numberOfExpandedArguments; i++)
+	{
+		free(table->expandedArguments[i]);
+	}
+	table->numberOfExpandedArguments = 0;
+
+	table->arguments = (char **)growArray(table->arguments, &table->argumentsCapacity, (size_t)argc + 1, sizeof(char *));
+	memcpy(table->arguments, argv, ((size_t)argc + 1) * sizeof(char *));
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *		arg = argv[i];
+		const struct option *	match;
+		size_t			dashesLength;
+		size_t			nameLength;
+
+		if (strcmp(arg, "--") == 0)
+		{
+			break;
+		}
+
+		if ((arg[0] == '-') && (arg[1] == '-'))
+		{
+			dashesLength = 2;
+		}
+		else if ((arg[0] == '-') || ((arg[0] == '+') && getOptIsNewlib()))
+		{
+			dashesLength = 1;
+		}
+		else
+		{
+			continue;
+		}
+
+		nameLength = strcspn(arg + dashesLength, "=");
+		if (nameLength == 0)
+		{
+			continue;
+		}
+
+		match = findLongOption(table, arg + dashesLength, nameLength);
+		if (match == NULL)
+		{
+			char *	expandedArgument;
+
+			match = findAbbreviatedLongOption(table, arg + dashesLength, nameLength);
+			if (match == NULL)
+			{
+				if (isUnabbreviatedLongOptionPrefix(table, arg + dashesLength, nameLength))
+				{
+					fprintf(stderr, "Error: Invalid option: '-%s' provided.\n", arg + 1);
+
+					return kCommonConstantReturnTypeError;
+				}
+				continue;
+			}
+
+			expandedArgument = (char *)checkedMalloc(strlen(arg) - nameLength + strlen(match->name) + 1, __FILE__, __LINE__);
+			sprintf(expandedArgument, "%.*s%s%s", (int)dashesLength, arg, match->name, arg + dashesLength + nameLength);
+
+			table->expandedArguments = (char **)growArray(
+								table->expandedArguments,
+								&table->expandedArgumentsCapacity,
+								table->numberOfExpandedArguments + 1,
+								sizeof(char *));
+			table->expandedArguments[table->numberOfExpandedArguments++] = expandedArgument;
+			table->arguments[i] = expandedArgument;
+		}
+
+		/*
+		 *	Skip the argument of the option, so that it is not taken for an option.
+		 */
+		if ((match->has_arg == required_argument) && (arg[dashesLength + nameLength] != '='))
+		{
+			i++;
+		}
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+static CommonConstantReturnType
 parseArgsCoreImplementation(
-	int		argc,
-	char *  const	argv[],
-	DemoOption *	options,
-	size_t		optionsSize)
+	int			argc,
+	char *  const		commandLineArguments[],
+	DemoOptionTable *	table,
+	DemoOption *		commonOptions)
+{
+	struct option *	longOptions = table->longOptions;
+	char * const *	argv;
+	bool		error = false;
+	int		longIndex;
+	int		previousOptInd;
+	int		opt;
+
+	/*
+	 *	Set initial values for `foundOpt` and `foundArg`.
+	 */
+	resetDemoOptionFindings(table->demoSpecificOptions, table->numberOfDemoSpecificOptions);
+	resetDemoOptionFindings(commonOptions, table->numberOfCommonOptions);
+
+	if (expandAbbreviatedArguments(argc, commandLineArguments, table) != kCommonConstantReturnTypeSuccess)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+	argv = table->arguments;
+
+	optind = 0;
+	opterr = 0;
+
+	/*
+	 *	From the getopt man page:
+	 *
+	 *	> The variable optind is the index of the next element to be processed in argv.
+	 *
+	 *	Therefore, we remember the previous value of optind which tells us the index of the
+	 *	_current_ index being processed. This is very useful for error messages.
+	 */
+	previousOptInd = 1;
+
+	while (!error)
+	{
+		longIndex = -1;
+
+		/*
+		 *	Rather than support both long and short opts (and maintain code to handle
+		 *	both), we only support long opts. However, we use the `_only` form of
+		 *	`getopt_long` which allows users to specify long opts with a single dash.
+		 *
+		 *	Therefore, specify a single character long opt and this will parse short
+		 *	opts as well! The only catch is that you cannot group short opts: something
+		 *	like `-To` must be instead written `-T -o`. I think this is a fine
+		 *	compromise to make.
+		 */
+		modifyNextArgvForNewLibc(argv);
+		opt = getopt_long_only(argc, argv, ":", longOptions, &longIndex);
+
+		if (opt == -1)
+		{
+			break;
+		}
+
+		if (longIndex == -1)
+		{
+			/*
+			 *	Error case.
+			 */
+			switch (opt)
+			{
+				case '?':
+				{
+					/*
+					 *	The invalid long opts can be found at
+					 *	`argv[previousOptInd]`. We know the first character
+					 *	when printing will (prior to
+					 *	`modifyNextArgvForNewLibc`) be '-' so we print that
+					 *	explicitly.
+					 */
+					fprintf(stderr, "Error: Invalid option: '-%s' provided.\n", argv[previousOptInd] + 1);
+					break;
+				}
+				case ':':
+				{
+					/*
+					 *	The long opts that is missing an argument can be
+					 *	found at `argv[optind - 1]`. We know the first
+					 *	character when printing will (prior to
+					 *	`modifyNextArgvForNewLibc`) be '-' so we print that
+					 *	explicitly.
+					 */
+					fprintf(stderr, "Error: Option '-%s' is missing mandatory argument.\n", argv[optind - 1] + 1);
+					break;
+				}
+				default:
+				{
+					fprintf(stderr, "Error: Unhandled getopt error return value: -%c.\n", opt);
+					break;
+				}
+			}
+
+			error = true;
+			break;
+		}
+
+		assert(opt >= 0);
+		assert((size_t)opt < table->numberOfDemoSpecificOptions + table->numberOfCommonOptions);
+
+		DemoOption *	option = ((size_t)opt < table->numberOfDemoSpecificOptions) ?
+						&table->demoSpecificOptions[opt] :
+						&commonOptions[opt - table->numberOfDemoSpecificOptions];
+
+		if (option->foundOpt != NULL)
+		{
+			*(option->foundOpt) = true;
+		};
+
+		if (option->hasArg)
+		{
+			if (optarg == NULL)
+			{
+				fatal("Internal error: option -%s missing argument.", longOptions[longIndex].name);
+			}
+
+			if (option->foundArg != NULL)
+			{
+				*(option->foundArg) = optarg;
+			}
+		}
+
+		previousOptInd = optind;
+	}
+
+	if (!error && optind < argc)
+	{
+		fprintf(stderr, "Error: Unexpected argument '%s'\n", argv[optind]);
+		error = true;
+	}
+
+	return(error ? kCommonConstantReturnTypeError : kCommonConstantReturnTypeSuccess);
+}
+
+/*
+ *	Copy `paths` into a single allocation: the array of pointers, then the strings.
+ */
+static const char **
+packInputFilePaths(const char * const *  paths, size_t  numberOfPaths)
+{
+	size_t		size = numberOfPaths * sizeof(char *);
+	const char **	packedPaths;
+	char *		cursor;
+
+	for (size_t i = 0; i < numberOfPaths; i++)
+	{
+		size += strlen(paths[i]) + 1;
+	}
+
+	packedPaths = (const char **)checkedMalloc(size, __FILE__, __LINE__);
+	cursor = (char *)(packedPaths + numberOfPaths);
+	for (size_t i = 0; i < numberOfPaths; i++)
+	{
+		size_t	length = strlen(paths[i]) + 1;
+
+		memcpy(cursor, paths[i], length);
+		packedPaths[i] = cursor;
+		cursor += length;
+	}
+
+	return packedPaths;
+}
+
+#ifdef COMMON_HAVE_GLOB
+static int
+compareInputFilePaths(const void *  a, const void *  b)
+{
+	return strcmp(*(const char * const *)a, *(const char * const *)b);
+}
+
+/*
+ *	The regular files named "*.csv" in the directory `directoryPath`, sorted.
+ */
+static CommonConstantReturnType
+listInputDirectory(const char *  directoryPath, const char ***  paths, size_t *  numberOfPaths)
+{
+	DIR *		directory = opendir(directoryPath);
+	struct dirent *	entry;
+	char **		entries = NULL;
+	size_t		numberOfEntries = 0;
+	size_t		capacity = 0;
+
+	if (directory == NULL)
+	{
+		fprintf(stderr, "Error: Cannot open the directory %s.\n", directoryPath);
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	while ((entry = readdir(directory)) != NULL)
+	{
+		size_t		nameLength = strlen(entry->d_name);
+		size_t		pathSize = strlen(directoryPath) + 1 + nameLength + 1;
+		char *		path;
+		struct stat	fileStatus;
+
+		if ((nameLength <= 4) || (strcmp(entry->d_name + nameLength - 4, ".csv") != 0))
+		{
+			continue;
+		}
+
+		path = (char *)checkedMalloc(pathSize, __FILE__, __LINE__);
+		snprintf(path, pathSize, "%s/%s", directoryPath, entry->d_name);
+		if ((stat(path, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode))
+		{
+			free(path);
+			continue;
+		}
+
+		if (numberOfEntries == capacity)
+		{
+			capacity = (capacity == 0) ? 16 : 2 * capacity;
+			entries = (char **)realloc(entries, capacity * sizeof(char *));
+			if (entries == NULL)
+			{
+				fatal("realloc() failed to allocate %zu bytes at %s:%d", capacity * sizeof(char *), __FILE__, __LINE__);
+			}
+		}
+		entries[numberOfEntries++] = path;
+	}
+	closedir(directory);
+
+	if (numberOfEntries > 0)
+	{
+		qsort(entries, numberOfEntries, sizeof(char *), compareInputFilePaths);
+		*paths = packInputFilePaths((const char * const *)entries, numberOfEntries);
+		*numberOfPaths = numberOfEntries;
+	}
+	else
+	{
+		fprintf(stderr, "Error: The directory %s has no CSV files.\n", directoryPath);
+	}
+
+	for (size_t i = 0; i < numberOfEntries; i++)
+	{
+		free(entries[i]);
+	}
+	free(entries);
+
+	return (numberOfEntries > 0) ? kCommonConstantReturnTypeSuccess : kCommonConstantReturnTypeError;
+}
+#endif /* COMMON_HAVE_GLOB */
+
+/*
+ *	Expand the input path `inputArg` into `*paths`: the CSV files of a directory, the
+ *	matches of a glob pattern, or else just `inputArg` itself.
+ */
+static CommonConstantReturnType
+expandInputFilePathPattern(const char *  inputArg, const char ***  paths, size_t *  numberOfPaths)
+{
+	*paths = NULL;
+	*numberOfPaths = 0;
+
+#ifdef COMMON_HAVE_GLOB
+	struct stat	fileStatus;
+
+	if ((stat(inputArg, &fileStatus) == 0) && S_ISDIR(fileStatus.st_mode))
+	{
+		return listInputDirectory(inputArg, paths, numberOfPaths);
+	}
+
+	if ((stat(inputArg, &fileStatus) != 0) && (strpbrk(inputArg, "*?[") != NULL))
+	{
+		glob_t	matches;
+		int	result = glob(inputArg, 0, NULL, &matches);
+
+		if (result != 0)
+		{
+			fprintf(stderr, "Error: No input files match '%s'.\n", inputArg);
+			globfree(&matches);
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		*paths = packInputFilePaths((const char * const *)matches.gl_pathv, matches.gl_pathc);
+		*numberOfPaths = matches.gl_pathc;
+		globfree(&matches);
+
+		return kCommonConstantReturnTypeSuccess;
+	}
+#endif /* COMMON_HAVE_GLOB */
+
+	*paths = packInputFilePaths(&inputArg, 1);
+	*numberOfPaths = 1;
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+enum
+{
+	/*
+	 *	The common options of the first releases, which `-i`, `-t` and the other unique
+	 *	prefixes of their names have always abbreviated.
+	 */
+	kNumberOfReservedCommonOptions	= 9,
+};
+
+CommonConstantReturnType
+parseArgs(
+	int				argc,
+	char *  const 			argv[],
+	CommonCommandLineArguments *	arguments,
+	DemoOption *			demoSpecificOptions)
+{
+	static DemoOptionTable	optionTable;
+
+	return parseArgsWithOptionTable(argc, argv, arguments, demoSpecificOptions, &optionTable);
+}
+
+CommonConstantReturnType
+parseArgsWithOptionTable(
+	int				argc,
+	char *  const 			argv[],
+	CommonCommandLineArguments *	arguments,
+	DemoOption *			demoSpecificOptions,
+	DemoOptionTable *		optionTable)
+{
+	assert(arguments != NULL);
+	assert(optionTable != NULL);
+
+	setDefaultCommandLineArgumentValues(arguments);
+
+	const char *	inputArg = NULL;
+	const char *	outputArg = NULL;
+	const char *	outputSelectArg = NULL;
+	const char *	multipleExecutionsArg = NULL;
+	const char *	inputCacheArg = NULL;
+	const char *	monteCarloOutputArg = NULL;
+	const char *	monteCarloOutputFormatArg = NULL;
+	const char *	jsonParticleEncodingArg = NULL;
+	const char *	threadsArg = NULL;
+	const char *	sketchSizeArg = NULL;
+	const char *	sketchSeedArg = NULL;
+	bool		isPrescanOptionFound = false;
+	DemoOption	commonOptions[] = {
+						{ "input",			"i",	true,	&inputArg,			NULL },
+						{ "output",			"o",	true,	&outputArg,			NULL },
+						{ "select-output",		"S",	true,	&outputSelectArg,		NULL },
+						{ "time",			"T",	false,	NULL,				&arguments->isTimingEnabled },
+						{ "multiple-executions",	"M",	true,	&multipleExecutionsArg,		NULL },
+						{ "verbose",			"v",	false,	NULL,				&arguments->isVerbose },
+						{ "json",			"j",	false,	NULL,				&arguments->isOutputJSONMode },
+						{ "help",			"h",	false,	NULL,				&arguments->isHelpEnabled },
+						{ "benchmarking",		"b",	false,	NULL,				&arguments->isBenchmarkingMode },
+						/*
+						 *	Options added since: a demo option of the same name
+						 *	takes precedence over these.
+						 */
+						{ "csv-cache",			NULL,	true,	&inputCacheArg,			NULL },
+						{ "data-out",			NULL,	true,	&monteCarloOutputArg,		NULL },
+						{ "data-out-format",		NULL,	true,	&monteCarloOutputFormatArg,	NULL },
+						{ "particle-encoding",		NULL,	true,	&jsonParticleEncodingArg,	NULL },
+						{ "worker-threads",		NULL,	true,	&threadsArg,			NULL },
+						{ "csv-sketch-size",		NULL,	true,	&sketchSizeArg,			NULL },
+						{ "csv-sketch-seed",		NULL,	true,	&sketchSeedArg,			NULL },
+						{ "csv-prescan",		NULL,	false,	NULL,				&isPrescanOptionFound },
+						{ ZERO_STRUCT_INIT }
+					};
+
+	if (!isDemoOptionTableCurrent(optionTable, demoSpecificOptions))
+	{
+		buildDemoOptionTable(optionTable, demoSpecificOptions, commonOptions, kNumberOfReservedCommonOptions);
+	}
+
+	if (parseArgsCoreImplementation(argc, argv, optionTable, commonOptions) != kCommonConstantReturnTypeSuccess)
+	{
+		return kCommonConstantReturnTypeError;
+	}
+
+	if (inputArg != NULL)
+	{
+		int ret = snprintf(arguments->inputFilePath, kCommonConstantMaxCharsPerFilepath, "%s", inputArg);
+
+		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
+		{
+			fprintf(stderr, "Error: Could not read input file path from command-line arguments.\n");
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->isInputFromFileEnabled = true;
+		}
+	}
+
+	if (outputArg != NULL)
+	{
+		int ret = snprintf(arguments->outputFilePath, kCommonConstantMaxCharsPerFilepath, "%s", outputArg);
+
+		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
+		{
+			fprintf(stderr, "Error: Could not read output file path from command-line arguments.\n");
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->isWriteToFileEnabled = true;
+		}
+	}
+
+	if (outputSelectArg != NULL)
+	{
+		int	outputSelect;
+		int	ret = parseIntChecked(outputSelectArg, &outputSelect);
+
+		if (ret != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: The output selected must be an integer.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else if (outputSelect < 0)
+		{
+			fprintf(stderr, "Error: The output selected must be non-negative.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->outputSelect = outputSelect;
+			arguments->isOutputSelected = true;
+		}
+	}
+
+	if (multipleExecutionsArg != NULL)
+	{
+		int	multipleExecutions;
+		int	ret = parseIntChecked(multipleExecutionsArg, &multipleExecutions);
+
+		if (ret != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: The number of multiple executions must be an integer.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else if (multipleExecutions <= 0)
+		{
+			fprintf(stderr, "Error: The number of multiple executions must be positive.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->numberOfMonteCarloIterations = multipleExecutions;
+
+			arguments->isMonteCarloMode = true;
+			arguments->isTimingEnabled = true;
+			arguments->isSingleShotExecution = false;
+		}
+	}
+
+	if (inputCacheArg != NULL)
+	{
+		int ret = snprintf(arguments->inputCacheDirectoryPath, kCommonConstantMaxCharsPerFilepath, "%s", inputCacheArg);
+
+		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
+		{
+			fprintf(stderr, "Error: Could not read input cache directory path from command-line arguments.\n");
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->isInputCacheEnabled = true;
+			setCSVInputCache(arguments->inputCacheDirectoryPath, arguments->isVerbose);
+		}
+	}
+
+	if (monteCarloOutputArg != NULL)
+	{
+		int ret = snprintf(arguments->monteCarloOutputFilePath, kCommonConstantMaxCharsPerFilepath, "%s", monteCarloOutputArg);
+
+		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
+		{
+			fprintf(stderr, "Error: Could not read Monte Carlo output file path from command-line arguments.\n");
+			return kCommonConstantReturnTypeError;
+		}
+	}
+
+	if (monteCarloOutputFormatArg != NULL)
+	{
+		if (strcmp(monteCarloOutputFormatArg, "text") == 0)
+		{
+			arguments->monteCarloOutputFormat = kMonteCarloOutputFormatText;
+		}
+		else if (strcmp(monteCarloOutputFormatArg, "binary") == 0)
+		{
+			arguments->monteCarloOutputFormat = kMonteCarloOutputFormatBinary;
+		}
+		else if (strcmp(monteCarloOutputFormatArg, "lz4") == 0)
+		{
+			arguments->monteCarloOutputFormat = kMonteCarloOutputFormatLZ4;
+		}
+		else
+		{
+			fprintf(stderr, "Error: The Monte Carlo output format must be one of 'text', 'binary' or 'lz4'.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+	}
+
+	if ((monteCarloOutputArg != NULL) || (monteCarloOutputFormatArg != NULL))
+	{
+		setMonteCarloOutput(arguments->monteCarloOutputFilePath, arguments->monteCarloOutputFormat);
+	}
+
+	if (jsonParticleEncodingArg != NULL)
+	{
+		if (strcmp(jsonParticleEncodingArg, "text") == 0)
+		{
+			arguments->jsonParticleEncoding = kJSONParticleEncodingText;
+		}
+		else if (strcmp(jsonParticleEncodingArg, "base64") == 0)
+		{
+			arguments->jsonParticleEncoding = kJSONParticleEncodingBase64;
+		}
+		else
+		{
+			fprintf(stderr, "Error: The JSON particle encoding must be one of 'text' or 'base64'.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+
+		setJSONParticleEncoding(arguments->jsonParticleEncoding);
+	}
+
+	if (threadsArg != NULL)
+	{
+		int	threads;
+		int	ret = parseIntChecked(threadsArg, &threads);
+
+		if (ret != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: The number of threads must be an integer.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else if (threads < 0)
+		{
+			fprintf(stderr, "Error: The number of threads must be non-negative.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->numberOfThreads = getMonteCarloThreadCount(threads);
+			setCSVInputParsingThreadCount(arguments->numberOfThreads);
+		}
+	}
+
+	if (sketchSizeArg != NULL)
+	{
+		int	sketchSize;
+		int	ret = parseIntChecked(sketchSizeArg, &sketchSize);
+
+		if (ret != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: The sketch size must be an integer.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else if (sketchSize < 0)
+		{
+			fprintf(stderr, "Error: The sketch size must be non-negative.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->sketchSize = sketchSize;
+		}
+	}
+
+	if (sketchSeedArg != NULL)
+	{
+		uint64_t	sketchSeed;
+		int		ret = parseUint64Checked(sketchSeedArg, &sketchSeed);
+
+		if (ret != kCommonConstantReturnTypeSuccess)
+		{
+			fprintf(stderr, "Error: The sketch seed must be a non-negative 64-bit integer.\n");
+
+			return kCommonConstantReturnTypeError;
+		}
+		else
+		{
+			arguments->sketchSeed = sketchSeed;
+		}
+	}
+
+	if ((sketchSizeArg != NULL) || (sketchSeedArg != NULL))
+	{
+		setCSVInputSketch(arguments->sketchSize, arguments->sketchSeed, arguments->isVerbose);
+	}
+
+	if (isPrescanOptionFound)
+	{
+		arguments->isInputPrescanEnabled = true;
+		setCSVInputPrescan(true);
+	}
+
+#ifdef COMMON_ENABLE_INSTRUMENTATION
+	if (arguments->isVerbose || arguments->isTimingEnabled)
+	{
+		static bool	isSummaryRegistered = false;
+
+		isInstrumentationSummaryJSON = arguments->isOutputJSONMode;
+		if (!isSummaryRegistered)
+		{
+			isSummaryRegistered = (atexit(printInstrumentationSummaryAtExit) == 0);
+		}
+	}
+#endif /* COMMON_ENABLE_INSTRUMENTATION */
+
+	/*
+	 *	JSON output mode and benchmarking mode are not compatible.
+	 */
+	if ((arguments->isOutputJSONMode) && (arguments->isBenchmarkingMode))
+	{
+		fprintf(stderr, "Error: Output JSON mode and benchmarking mode are not compatible. Please choose only one.\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+CommonConstantReturnType
+expandInputFilePaths(CommonCommandLineArguments *  arguments)
+{
+	assert(arguments != NULL);
+
+	if (arguments->inputFilePaths != NULL)
+	{
+		return kCommonConstantReturnTypeSuccess;
+	}
+
+	if (!arguments->isInputFromFileEnabled)
+	{
+		fprintf(stderr, "Error: No input file was given with -i.\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	return expandInputFilePathPattern(arguments->inputFilePath, &arguments->inputFilePaths, &arguments->numberOfInputFiles);
+}
+
+void
+freeCommandLineArguments(CommonCommandLineArguments *  arguments)
+{
+	assert(arguments != NULL);
+
+	free(arguments->inputFilePaths);
+	arguments->inputFilePaths = NULL;
+	arguments->numberOfInputFiles = 0;
+}
+
+void
+printCommonUsage(void)
+{
+	fprintf(stderr, "Usage: Valid command-line arguments are:\n");
+	fprintf(
+		stderr,
+		"\t[-i, --input <Path to input CSV or binary columns file, directory of CSV files, or glob pattern : str>] (Read inputs from file.)\n"
+		"\t[-o, --output <Path to output CSV file : str>] (Specify the output file.)\n"
+		"\t[-S, --select-output <output : int>] (Compute 0-indexed output, by default 0.)\n"
+		"\t[-M, --multiple-executions <Number of executions : int (Default: 1)>] (Repeated execute kernel for benchmarking.)\n"
+		"\t[-T, --time] (Timing mode: Times and prints the timing of the kernel execution.)\n"
+		"\t[-v, --verbose] (Verbose mode: Prints extra information about demo execution.)\n"
+		"\t[-b, --benchmarking] (Benchmarking mode: Generate outputs in format for benchmarking.)\n"
+		"\t[--csv-cache <Path to cache directory : str>] (Cache parsed CSV inputs across runs.)\n"
+		"\t[--data-out <Path to Monte Carlo output file : str (Default: data.out)>] (Specify the Monte Carlo samples file.)\n"
+		"\t[--data-out-format <text|binary|lz4 : str (Default: text)>] (Format of the Monte Carlo samples file.)\n"
+		"\t[--particle-encoding <text|base64 : str (Default: text)>] (Encoding of particle values in JSON output.)\n"
+		"\t[--worker-threads <Number of threads : int (Default: 1)>] (Threads for Monte Carlo executions and input parsing, 0 for all processors.)\n"
+		"\t[--csv-sketch-size <Samples kept per input column : int (Default: 0, all)>] (Read inputs in bounded memory.)\n"
+		"\t[--csv-sketch-seed <Seed of the kept samples : uint64 (Default: 0)>]\n"
+		"\t[--csv-prescan] (Check the shape of every input row before parsing any.)\n"
+		"\t[-j, --json] (Print output in JSON format.)\n"
+		"\t[-h, --help] (Display this help message.)\n");
+}
+
+enum
+{
+	kSampleMomentsBlockSize	= 256,
+};
+
+/*
+ *	Central moments of a set of samples: `m2`, `m3` and `m4` are the sums of the
+ *	second, third and fourth powers of the deviations from `mean`.
+ */
+typedef struct
+{
+	double	count;
+	double	mean;
+	double	m2;
+	double	m3;
+	double	m4;
+	double	min;
+	double	max;
+} SampleMomentsAccumulator;
+
+/*
+ *	Return the sum of the `blockSize` samples in `block`, 4 (AVX2) or 2 (SSE2, NEON)
+ *	lanes at a time where available.
+ */
+static double
+sumSampleMomentsBlock(const double *  block, size_t  blockSize)
+{
+	double	sum = 0;
+	size_t	i = 0;
+
+#if defined(__AVX2__)
+	__m256d	lanes = _mm256_setzero_pd();
+	double	laneSums[4];
+
+	for (; i + 4 <= blockSize; i += 4)
+	{
+		lanes = _mm256_add_pd(lanes, _mm256_loadu_pd(block + i));
+	}
+	_mm256_storeu_pd(laneSums, lanes);
+	sum = (laneSums[0] + laneSums[1]) + (laneSums[2] + laneSums[3]);
+#elif defined(__SSE2__)
+	__m128d	lanes = _mm_setzero_pd();
+	double	laneSums[2];
+
+	for (; i + 2 <= blockSize; i += 2)
+	{
+		lanes = _mm_add_pd(lanes, _mm_loadu_pd(block + i));
+	}
+	_mm_storeu_pd(laneSums, lanes);
+	sum = laneSums[0] + laneSums[1];
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	float64x2_t	lanes = vdupq_n_f64(0);
+
+	for (; i + 2 <= blockSize; i += 2)
+	{
+		lanes = vaddq_f64(lanes, vld1q_f64(block + i));
+	}
+	sum = vaddvq_f64(lanes);
+#endif
+
+	for (; i < blockSize; i++)
+	{
+		sum += block[i];
+	}
+
+	return sum;
+}
+
+/*
+ *	Add the sums of the first to fourth powers of the deviations of the `blockSize`
+ *	samples in `block` from `center` to `sums`, and their extremes to `accumulator`.
+ */
+static void
+sumSampleMomentsBlockDeviations(
+	const double *			block,
+	size_t				blockSize,
+	double				center,
+	double				sums[4],
+	SampleMomentsAccumulator *	accumulator)
+{
+	size_t	i = 0;
+
+#if defined(__AVX2__)
+	const __m256d	centers = _mm256_set1_pd(center);
+	__m256d		s1 = _mm256_setzero_pd();
+	__m256d		s2 = _mm256_setzero_pd();
+	__m256d		s3 = _mm256_setzero_pd();
+	__m256d		s4 = _mm256_setzero_pd();
+	__m256d		min = _mm256_set1_pd(accumulator->min);
+	__m256d		max = _mm256_set1_pd(accumulator->max);
+	double		lanes[6][4];
+
+	for (; i + 4 <= blockSize; i += 4)
+	{
+		__m256d	values = _mm256_loadu_pd(block + i);
+		__m256d	d = _mm256_sub_pd(values, centers);
+		__m256d	dSquared = _mm256_mul_pd(d, d);
+
+		s1 = _mm256_add_pd(s1, d);
+		s2 = _mm256_add_pd(s2, dSquared);
+		s3 = _mm256_add_pd(s3, _mm256_mul_pd(dSquared, d));
+		s4 = _mm256_add_pd(s4, _mm256_mul_pd(dSquared, dSquared));
+		min = _mm256_min_pd(min, values);
+		max = _mm256_max_pd(max, values);
+	}
+	_mm256_storeu_pd(lanes[0], s1);
+	_mm256_storeu_pd(lanes[1], s2);
+	_mm256_storeu_pd(lanes[2], s3);
+	_mm256_storeu_pd(lanes[3], s4);
+	_mm256_storeu_pd(lanes[4], min);
+	_mm256_storeu_pd(lanes[5], max);
+	for (int lane = 0; lane < 4; lane++)
+	{
+		for (int k = 0; k < 4; k++)
+		{
+			sums[k] += lanes[k][lane];
+		}
+		accumulator->min = (lanes[4][lane] < accumulator->min) ? lanes[4][lane] : accumulator->min;
+		accumulator->max = (lanes[5][lane] > accumulator->max) ? lanes[5][lane] : accumulator->max;
+	}
+#elif defined(__SSE2__)
+	const __m128d	centers = _mm_set1_pd(center);
+	__m128d		s1 = _mm_setzero_pd();
+	__m128d		s2 = _mm_setzero_pd();
+	__m128d		s3 = _mm_setzero_pd();
+	__m128d		s4 = _mm_setzero_pd();
+	__m128d		min = _mm_set1_pd(accumulator->min);
+	__m128d		max = _mm_set1_pd(accumulator->max);
+	double		lanes[6][2];
+
+	for (; i + 2 <= blockSize; i += 2)
+	{
+		__m128d	values = _mm_loadu_pd(block + i);
+		__m128d	d = _mm_sub_pd(values, centers);
+		__m128d	dSquared = _mm_mul_pd(d, d);
+
+		s1 = _mm_add_pd(s1, d);
+		s2 = _mm_add_pd(s2, dSquared);
+		s3 = _mm_add_pd(s3, _mm_mul_pd(dSquared, d));
+		s4 = _mm_add_pd(s4, _mm_mul_pd(dSquared, dSquared));
+		min = _mm_min_pd(min, values);
+		max = _mm_max_pd(max, values);
+	}
+	_mm_storeu_pd(lanes[0], s1);
+	_mm_storeu_pd(lanes[1], s2);
+	_mm_storeu_pd(lanes[2], s3);
+	_mm_storeu_pd(lanes[3], s4);
+	_mm_storeu_pd(lanes[4], min);
+	_mm_storeu_pd(lanes[5], max);
+	for (int lane = 0; lane < 2; lane++)
+	{
+		for (int k = 0; k < 4; k++)
+		{
+			sums[k] += lanes[k][lane];
+		}
+		accumulator->min = (lanes[4][lane] < accumulator->min) ? lanes[4][lane] : accumulator->min;
+		accumulator->max = (lanes[5][lane] > accumulator->max) ? lanes[5][lane] : accumulator->max;
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const float64x2_t	centers = vdupq_n_f64(center);
+	float64x2_t		s1 = vdupq_n_f64(0);
+	float64x2_t		s2 = vdupq_n_f64(0);
+	float64x2_t		s3 = vdupq_n_f64(0);
+	float64x2_t		s4 = vdupq_n_f64(0);
+	float64x2_t		min = vdupq_n_f64(accumulator->min);
+	float64x2_t		max = vdupq_n_f64(accumulator->max);
+
+	for (; i + 2 <= blockSize; i += 2)
+	{
+		float64x2_t	values = vld1q_f64(block + i);
+		float64x2_t	d = vsubq_f64(values, centers);
+		float64x2_t	dSquared = vmulq_f64(d, d);
+
+		s1 = vaddq_f64(s1, d);
+		s2 = vaddq_f64(s2, dSquared);
+		s3 = vaddq_f64(s3, vmulq_f64(dSquared, d));
+		s4 = vaddq_f64(s4, vmulq_f64(dSquared, dSquared));
+		min = vminq_f64(min, values);
+		max = vmaxq_f64(max, values);
+	}
+	sums[0] += vaddvq_f64(s1);
+	sums[1] += vaddvq_f64(s2);
+	sums[2] += vaddvq_f64(s3);
+	sums[3] += vaddvq_f64(s4);
+	accumulator->min = vminvq_f64(min);
+	accumulator->max = vmaxvq_f64(max);
+#endif
+
+	for (; i < blockSize; i++)
+	{
+		double	d = block[i] - center;
+
+		sums[0] += d;
+		sums[1] += d * d;
+		sums[2] += d * d * d;
+		sums[3] += d * d * d * d;
+		accumulator->min = (block[i] < accumulator->min) ? block[i] : accumulator->min;
+		accumulator->max = (block[i] > accumulator->max) ? block[i] : accumulator->max;
+	}
+}
+
+/*
+ *	Add the `blockSize` samples in `block` to `accumulator`. The moments of the block
+ *	are taken in two passes over it, about its own mean, and then merged with those
+ *	of the samples before it (Chan et al. and Pébay's pairwise updates), so that
+ *	neither a large mean nor a large number of samples costs precision.
+ */
+static void
+addSampleMomentsBlock(SampleMomentsAccumulator *  accumulator, const double *  block, size_t  blockSize)
+{
+	double	nB = (double)blockSize;
+	double	sums[4] = { 0 };
+	double	meanB;
+	double	c;
+	double	m2B;
+	double	m3B;
+	double	m4B;
+	double	nA = accumulator->count;
+	double	n = nA + nB;
+	double	delta;
+
+	if (blockSize == 0)
+	{
+		return;
+	}
+
+	if (nA == 0)
+	{
+		accumulator->min = block[0];
+		accumulator->max = block[0];
+	}
+
+	meanB = sumSampleMomentsBlock(block, blockSize) / nB;
+	sumSampleMomentsBlockDeviations(block, blockSize, meanB, sums, accumulator);
+
+	/*
+	 *	The deviations need not sum to exactly zero: `c` corrects for the rounding of
+	 *	`meanB`.
+	 */
+	c = sums[0] / nB;
+	meanB += c;
+	m2B = sums[1] - nB * c * c;
+	m3B = sums[2] - 3 * c * sums[1] + 2 * nB * c * c * c;
+	m4B = sums[3] - 4 * c * sums[2] + 6 * c * c * sums[1] - 3 * nB * c * c * c * c;
+
+	delta = meanB - accumulator->mean;
+	accumulator->m4 += m4B
+			+ delta * delta * delta * delta * nA * nB * (nA * nA - nA * nB + nB * nB) / (n * n * n)
+			+ 6 * delta * delta * (nA * nA * m2B + nB * nB * accumulator->m2) / (n * n)
+			+ 4 * delta * (nA * m3B - nB * accumulator->m3) / n;
+	accumulator->m3 += m3B
+			+ delta * delta * delta * nA * nB * (nA - nB) / (n * n)
+			+ 3 * delta * (nA * m2B - nB * accumulator->m2) / n;
+	accumulator->m2 += m2B + delta * delta * nA * nB / n;
+	accumulator->mean += delta * nB / n;
+	accumulator->count = n;
+}
+
+static SampleMoments
+getSampleMoments(const SampleMomentsAccumulator *  accumulator)
+{
+	double	n = accumulator->count;
+	double	m2 = accumulator->m2;
+
+	if (n == 0)
+	{
+		return (SampleMoments){ 0 };
+	}
+
+	return (SampleMoments)
+	{
+		.count = (size_t)n,
+		.mean = accumulator->mean,
+		.variance = m2 / n,
+		.skewness = (m2 > 0) ? sqrt(n) * accumulator->m3 / (m2 * sqrt(m2)) : 0,
+		.kurtosis = (m2 > 0) ? n * accumulator->m4 / (m2 * m2) - 3 : 0,
+		.min = accumulator->min,
+		.max = accumulator->max,
+	};
+}
+
+SampleMoments
+calculateMomentsOfFloatSamples(
+	const float *	dataArray,
+	size_t		dataArraySize)
+{
+	SampleMomentsAccumulator	accumulator = { 0 };
+	double				block[kSampleMomentsBlockSize];
+
+	for (size_t i = 0; i < dataArraySize; i += kSampleMomentsBlockSize)
+	{
+		size_t	blockSize = (dataArraySize - i < kSampleMomentsBlockSize) ? dataArraySize - i : kSampleMomentsBlockSize;
+
+		for (size_t j = 0; j < blockSize; j++)
+		{
+			block[j] = dataArray[i + j];
+		}
+		addSampleMomentsBlock(&accumulator, block, blockSize);
+	}
+
+	return getSampleMoments(&accumulator);
+}
+
+SampleMoments
+calculateMomentsOfDoubleSamples(
+	const double *	dataArray,
+	size_t		dataArraySize)
+{
+	SampleMomentsAccumulator	accumulator = { 0 };
+
+	for (size_t i = 0; i < dataArraySize; i += kSampleMomentsBlockSize)
+	{
+		size_t	blockSize = (dataArraySize - i < kSampleMomentsBlockSize) ? dataArraySize - i : kSampleMomentsBlockSize;
+
+		addSampleMomentsBlock(&accumulator, dataArray + i, blockSize);
+	}
+
+	return getSampleMoments(&accumulator);
+}
+
+MeanAndVariance
+calculateMeanAndVarianceOfFloatSamples(
+	const float *	dataArray,
+	size_t		dataArraySize)
+{
+	SampleMoments	moments = calculateMomentsOfFloatSamples(dataArray, dataArraySize);
+
+	return (MeanAndVariance)
+	{
+		.mean = moments.mean,
+		.variance = moments.variance,
+	};
+}
+
+MeanAndVariance
+calculateMeanAndVarianceOfDoubleSamples(
+	const double *	dataArray,
+	size_t		dataArraySize)
+{
+	SampleMoments	moments = calculateMomentsOfDoubleSamples(dataArray, dataArraySize);
+
+	return (MeanAndVariance)
+	{
+		.mean = moments.mean,
+		.variance = moments.variance,
+	};
+}
+
+/*
+ *	Binary Monte Carlo sample files. All integers are little-endian:
+ *
+ *		offset	size	field
+ *		0	8	magic, `kMonteCarloSamplesMagic`
+ *		8	4	format version, `kMonteCarloSamplesVersion`
+ *		12	4	sample type, a `FloatingPointVariableType`
+ *		16	8	CPU time elapsed in microseconds
+ *		24	8	number of samples
+ *		32	4	flags, zero
+ *		36	4	reserved, zero
+ *		40		the samples, as little-endian IEEE-754 values
+ *
+ *	`kMonteCarloOutputFormatLZ4` writes the same file as a standard LZ4 frame with
+ *	independent blocks, which `lz4 -d` decompresses to exactly the bytes the binary
+ *	format writes. The header is the first block and every further block holds up to
+ *	`kMonteCarloSamplesBlockSize` bytes of samples.
+ */
+typedef enum
+{
+	kMonteCarloSamplesVersion		= 1,
+	kMonteCarloSamplesHeaderSize		= 40,
+	kMonteCarloSamplesBlockSize		= 1024 * 1024,
+} MonteCarloSamplesConstant;
+
+static const char	kMonteCarloSamplesMagic[8] = { '\x89', 'U', 'x', 'M', 'C', 'S', '\r', '\n' };
+
+/*
+ *	LZ4 frame format: magic, then the frame descriptor. The descriptor selects
+ *	version 1 with independent blocks and no checksums (0x60) and a maximum block
+ *	size of 1 MiB (0x60). Its last byte is the second byte of the XXH32 hash of
+ *	the two before it.
+ */
+static const uint8_t	kLZ4FrameHeader[7] = { 0x04, 0x22, 0x4d, 0x18, 0x60, 0x60, 0x51 };
+
+typedef enum
+{
+	kLZ4MinimumMatchLength		= 4,
+	kLZ4LastLiteralsLength		= 5,
+	kLZ4MatchFindLimit		= 12,
+	kLZ4MaximumOffset		= 65535,
+	kLZ4HashBits			= 14,
+	kLZ4BlockUncompressedFlag	= 0x80000000u,
+} LZ4Constant;
+
+static size_t
+getLZ4BlockSizeBound(size_t  inputSize)
+{
+	return inputSize + inputSize / 255 + 16;
+}
+
+static uint32_t
+hashLZ4Sequence(const uint8_t *  bytes)
+{
+	uint32_t	sequence;
+
+	memcpy(&sequence, bytes, sizeof(sequence));
+
+	return (sequence * UINT32_C(2654435761)) >> (32 - kLZ4HashBits);
+}
+
+static uint8_t *
+writeLZ4Length(uint8_t *  output, size_t  length)
+{
+	while (length >= 255)
+	{
+		*output++ = 255;
+		length -= 255;
+	}
+	*output++ = (uint8_t)length;
+
+	return output;
+}
+
+static uint8_t *
+writeLZ4Sequence(uint8_t *  output, const uint8_t *  literals, size_t  literalsLength, size_t  offset, size_t  matchLength)
+{
+	uint8_t *	token = output++;
+	size_t		matchCode = (matchLength >= kLZ4MinimumMatchLength) ? matchLength - kLZ4MinimumMatchLength : 0;
+
+	*token = (uint8_t)(((literalsLength < 15) ? literalsLength : 15) << 4);
+	if (literalsLength >= 15)
+	{
+		output = writeLZ4Length(output, literalsLength - 15);
+	}
+	memcpy(output, literals, literalsLength);
+	output += literalsLength;
+
+	/*
+	 *	The last sequence of a block has literals only.
+	 */
+	if (matchLength == 0)
+	{
+		return output;
+	}
+
+	*output++ = (uint8_t)offset;
+	*output++ = (uint8_t)(offset >> 8);
+	*token |= (uint8_t)((matchCode < 15) ? matchCode : 15);
+	if (matchCode >= 15)
+	{
+		output = writeLZ4Length(output, matchCode - 15);
+	}
+
+	return output;
+}
+
+/*
+ *	Compress `input` into the LZ4 block `output`, which has room for
+ *	`getLZ4BlockSizeBound(inputSize)` bytes, with a greedy single-hash match finder.
+ *	`hashTable` has `1 << kLZ4HashBits` entries. Returns the compressed size.
+ */
+static size_t
+compressLZ4Block(const uint8_t *  input, size_t  inputSize, uint8_t *  output, uint32_t *  hashTable)
+{
+	const uint8_t *	anchor = input;
+	const uint8_t *	cursor = input;
+	const uint8_t *	matchFindEnd = input + inputSize - kLZ4MatchFindLimit;
+	const uint8_t *	matchEnd = input + inputSize - kLZ4LastLiteralsLength;
+	uint8_t *	outputCursor = output;
+
+	memset(hashTable, 0, sizeof(uint32_t) << kLZ4HashBits);
+
+	while ((inputSize > kLZ4MatchFindLimit) && (cursor < matchFindEnd))
+	{
+		uint32_t	hash = hashLZ4Sequence(cursor);
+		const uint8_t *	candidate = input + hashTable[hash];
+		size_t		matchLength = kLZ4MinimumMatchLength;
+
+		hashTable[hash] = (uint32_t)(cursor - input);
+
+		if ((candidate >= cursor) || (cursor - candidate > kLZ4MaximumOffset) || (memcmp(candidate, cursor, kLZ4MinimumMatchLength) != 0))
+		{
+			/*
+			 *	Step faster through data that does not compress.
+			 */
+			cursor += 1 + ((size_t)(cursor - anchor) >> 6);
+			continue;
+		}
+
+		while ((cursor + matchLength < matchEnd) && (candidate[matchLength] == cursor[matchLength]))
+		{
+			matchLength++;
+		}
+
+		outputCursor = writeLZ4Sequence(outputCursor, anchor, (size_t)(cursor - anchor), (size_t)(cursor - candidate), matchLength);
+		cursor += matchLength;
+		anchor = cursor;
+	}
+
+	outputCursor = writeLZ4Sequence(outputCursor, anchor, (size_t)(input + inputSize - anchor), 0, 0);
+
+	return (size_t)(outputCursor - output);
+}
+
+/*
+ *	Append `input` to `sink` as one block of an LZ4 frame, stored uncompressed if it
+ *	does not compress. The block is compressed straight into the sink's page.
+ */
+static void
+appendLZ4FrameBlock(OutputSink *  sink, const uint8_t *  input, size_t  inputSize, uint32_t *  hashTable)
+{
+	OutputBuffer *	page = getOutputSinkBuffer(sink);
+	char *		blockSize;
+	size_t		compressedSize;
+	bool		isCompressed;
+
+	reserveOutputBuffer(page, 4 + getLZ4BlockSizeBound(inputSize));
+	blockSize = page->data + page->size;
+	compressedSize = compressLZ4Block(input, inputSize, (uint8_t *)blockSize + 4, hashTable);
+	isCompressed = (compressedSize < inputSize);
+	if (!isCompressed)
+	{
+		memcpy(blockSize + 4, input, inputSize);
+	}
+
+	storeLittleEndian32(blockSize, isCompressed ? (uint32_t)compressedSize : ((uint32_t)inputSize | kLZ4BlockUncompressedFlag));
+	page->size += 4 + (isCompressed ? compressedSize : inputSize);
+	commitOutputSink(sink);
+}
+
+/*
+ *	Streaming Monte Carlo samples: running moments plus, optionally, the samples file
+ *	written block by block as set by `setMonteCarloOutput()`.
+ */
+struct MonteCarloSampleSink
+{
+	FloatingPointVariableType	sampleType;
+	size_t				sampleSize;
+	MonteCarloOutputFormat		format;
+	OutputSink *			dump;
+	bool				isHeaderPatched;
+	uint8_t *			block;
+	uint32_t *			hashTable;
+	size_t				blockSize;
+	uint64_t			numberOfSamples;
+	double				mean;
+	double				sumOfSquaredDeviations;
+};
+
+enum
+{
+	/*
+	 *	Width of the zero-padded CPU time on the first line of a text samples file
+	 *	whose CPU time is only known after the samples.
+	 */
+	kMonteCarloSamplesPatchedTimeWidth	= 20,
+};
+
+static void
+storeMonteCarloSamplesHeader(
+	char *				header,
+	FloatingPointVariableType	sampleType,
+	uint64_t			cpuTimeElapsedMicroSeconds,
+	uint64_t			numberOfSamples)
+{
+	memset(header, 0, kMonteCarloSamplesHeaderSize);
+	memcpy(header, kMonteCarloSamplesMagic, sizeof(kMonteCarloSamplesMagic));
+	storeLittleEndian32(header + 8, kMonteCarloSamplesVersion);
+	storeLittleEndian32(header + 12, (uint32_t)sampleType);
+	storeLittleEndian64(header + 16, cpuTimeElapsedMicroSeconds);
+	storeLittleEndian64(header + 24, numberOfSamples);
+	storeLittleEndian32(header + 32, 0);
+}
+
+/*
+ *	Open a sink for samples of `sampleType`. If `isDumpEnabled`, the samples are also
+ *	written to the Monte Carlo samples file. If `isHeaderPatched`, its header is
+ *	completed when the sink is closed, otherwise it is written right away from
+ *	`cpuTimeElapsedMicroSeconds` and `numberOfSamples`.
+ */
+static MonteCarloSampleSink *
+startMonteCarloSampleSink(
+	FloatingPointVariableType	sampleType,
+	bool				isDumpEnabled,
+	bool				isHeaderPatched,
+	uint64_t			cpuTimeElapsedMicroSeconds,
+	uint64_t			numberOfSamples)
+{
+	MonteCarloSampleSink *	sink = (MonteCarloSampleSink *)checkedCalloc(1, sizeof(MonteCarloSampleSink), __FILE__, __LINE__);
+	char			header[kMonteCarloSamplesHeaderSize];
+	char			blockSize[4];
+
+	if ((sampleType != kFloatingPointVariableTypeFloat) && (sampleType != kFloatingPointVariableTypeDouble))
+	{
+		fatal("sampleType must be specified");
+	}
+
+	sink->sampleType = sampleType;
+	sink->sampleSize = (sampleType == kFloatingPointVariableTypeFloat) ? sizeof(float) : sizeof(double);
+	sink->format = monteCarloOutputFormat;
+	sink->isHeaderPatched = isHeaderPatched;
+
+	if (!isDumpEnabled)
+	{
+		return sink;
+	}
+
+	if ((sink->format != kMonteCarloOutputFormatText) && !isHostLittleEndian())
+	{
+		fatal("Binary Monte Carlo output cannot be written on big-endian hosts");
+	}
+
+	sink->dump = openOutputSink(monteCarloOutputFilePath, (sink->format == kMonteCarloOutputFormatText) ? "w" : "wb");
+	if (sink->dump == NULL)
+	{
+		fatal("Could not open monte carlo output file");
+	}
+
+	switch (sink->format)
+	{
+		case kMonteCarloOutputFormatText:
+		{
+			if (isHeaderPatched)
+			{
+				appendOutputBufferFormat(getOutputSinkBuffer(sink->dump), "%0*d\n", kMonteCarloSamplesPatchedTimeWidth, 0);
+			}
+			else
+			{
+				appendOutputBufferFormat(getOutputSinkBuffer(sink->dump), "%" PRIu64 "\n", cpuTimeElapsedMicroSeconds);
+			}
+			break;
+		}
+		case kMonteCarloOutputFormatBinary:
+		{
+			storeMonteCarloSamplesHeader(header, sampleType, cpuTimeElapsedMicroSeconds, numberOfSamples);
+			appendOutputSinkBytes(sink->dump, header, sizeof(header));
+			break;
+		}
+		case kMonteCarloOutputFormatLZ4:
+		default:
+		{
+			/*
+			 *	The header is stored as an uncompressed block, so that it can be
+			 *	patched in place.
+			 */
+			storeMonteCarloSamplesHeader(header, sampleType, cpuTimeElapsedMicroSeconds, numberOfSamples);
+			storeLittleEndian32(blockSize, kMonteCarloSamplesHeaderSize | kLZ4BlockUncompressedFlag);
+			appendOutputSinkBytes(sink->dump, kLZ4FrameHeader, sizeof(kLZ4FrameHeader));
+			appendOutputSinkBytes(sink->dump, blockSize, sizeof(blockSize));
+			appendOutputSinkBytes(sink->dump, header, sizeof(header));
+
+			sink->block = (uint8_t *)checkedMalloc(kMonteCarloSamplesBlockSize, __FILE__, __LINE__);
+			sink->hashTable = (uint32_t *)checkedMalloc(sizeof(uint32_t) << kLZ4HashBits, __FILE__, __LINE__);
+			break;
+		}
+	}
+
+	return sink;
+}
+
+/*
+ *	Compress the samples collected in the block of `sink`.
+ */
+static void
+flushMonteCarloSampleSinkBlock(MonteCarloSampleSink *  sink)
+{
+	if (sink->blockSize == 0)
+	{
+		return;
+	}
+
+	appendLZ4FrameBlock(sink->dump, sink->block, sink->blockSize, sink->hashTable);
+	sink->blockSize = 0;
+}
+
+/*
+ *	Add `count` samples at `samples`, of the sink's sample type, to `sink`.
+ */
+static void
+pushMonteCarloSamples(MonteCarloSampleSink *  sink, const void *  samples, size_t  count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		double	value = (sink->sampleType == kFloatingPointVariableTypeFloat) ? ((const float *)samples)[i] : ((const double *)samples)[i];
+		double	delta = value - sink->mean;
+
+		/*
+		 *	Welford's update of the mean and of the sum of squared deviations.
+		 */
+		sink->numberOfSamples++;
+		sink->mean += delta / (double)sink->numberOfSamples;
+		sink->sumOfSquaredDeviations += delta * (value - sink->mean);
+	}
+
+	if (sink->dump == NULL)
+	{
+		return;
+	}
+
+	switch (sink->format)
+	{
+		case kMonteCarloOutputFormatText:
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				if (sink->sampleType == kFloatingPointVariableTypeFloat)
+				{
+					appendOutputBufferFormat(getOutputSinkBuffer(sink->dump), "%.20f\n", ((const float *)samples)[i]);
+				}
+				else
+				{
+					appendOutputBufferFormat(getOutputSinkBuffer(sink->dump), "%.20lf\n", ((const double *)samples)[i]);
+				}
+				commitOutputSink(sink->dump);
+			}
+			break;
+		}
+		case kMonteCarloOutputFormatBinary:
+		{
+			appendOutputSinkBytes(sink->dump, samples, count * sink->sampleSize);
+			break;
+		}
+		case kMonteCarloOutputFormatLZ4:
+		default:
+		{
+			const uint8_t *	bytes = (const uint8_t *)samples;
+			size_t		size = count * sink->sampleSize;
+
+			while (size > 0)
+			{
+				size_t	chunkSize = kMonteCarloSamplesBlockSize - sink->blockSize;
+
+				chunkSize = (chunkSize < size) ? chunkSize : size;
+				memcpy(sink->block + sink->blockSize, bytes, chunkSize);
+				sink->blockSize += chunkSize;
+				bytes += chunkSize;
+				size -= chunkSize;
+
+				if (sink->blockSize == kMonteCarloSamplesBlockSize)
+				{
+					flushMonteCarloSampleSinkBlock(sink);
+				}
+			}
+			break;
+		}
+	}
+}
+
+MonteCarloSampleSink *
+openMonteCarloSampleSink(FloatingPointVariableType  sampleType, bool  isDumpEnabled)
 {
-	size_t		longOptionsSize = 0;
-	struct option *	longOptions = NULL;
-	bool		error = false;
-	int		longIndex;
-	int		previousOptInd;
-	int		opt;
+	return startMonteCarloSampleSink(sampleType, isDumpEnabled, true, 0, 0);
+}
 
-	/*
-	 *	Set initial values for `foundOpt` and `foundArg`.
-	 */
-	for (size_t i = 0; i < optionsSize; ++i)
+void
+pushMonteCarloFloatSample(MonteCarloSampleSink *  sink, float  sample)
+{
+	assert(sink->sampleType == kFloatingPointVariableTypeFloat);
+
+	pushMonteCarloSamples(sink, &sample, 1);
+}
+
+void
+pushMonteCarloDoubleSample(MonteCarloSampleSink *  sink, double  sample)
+{
+	assert(sink->sampleType == kFloatingPointVariableTypeDouble);
+
+	pushMonteCarloSamples(sink, &sample, 1);
+}
+
+MeanAndVariance
+closeMonteCarloSampleSink(MonteCarloSampleSink *  sink, uint64_t  cpuTimeElapsedMicroSeconds)
+{
+	MeanAndVariance	result = {
+				.mean = sink->mean,
+				.variance = (sink->numberOfSamples > 0) ? sink->sumOfSquaredDeviations / (double)sink->numberOfSamples : 0.0,
+			};
+	char		patch[kMonteCarloSamplesPatchedTimeWidth + 1];
+	char		header[kMonteCarloSamplesHeaderSize];
+	uint8_t		endMark[4] = { 0 };
+
+	if (sink->dump != NULL)
 	{
-		if (options[i].foundOpt != NULL)
+		if (sink->format == kMonteCarloOutputFormatLZ4)
 		{
-			*(options[i].foundOpt) = false;
+			flushMonteCarloSampleSinkBlock(sink);
+			appendOutputSinkBytes(sink->dump, endMark, sizeof(endMark));
 		}
-		if (options[i].foundArg != NULL)
+
+		if (sink->isHeaderPatched && (sink->format == kMonteCarloOutputFormatText))
 		{
-			*(options[i].foundArg) = NULL;
+			snprintf(patch, sizeof(patch), "%0*" PRIu64, kMonteCarloSamplesPatchedTimeWidth, cpuTimeElapsedMicroSeconds);
+			setOutputSinkPatch(sink->dump, 0, patch, kMonteCarloSamplesPatchedTimeWidth);
+		}
+		else if (sink->isHeaderPatched)
+		{
+			/*
+			 *	Patch the CPU time and the number of samples. In an LZ4 frame the header
+			 *	follows the frame header and the size of its block.
+			 */
+			storeMonteCarloSamplesHeader(header, sink->sampleType, cpuTimeElapsedMicroSeconds, sink->numberOfSamples);
+			setOutputSinkPatch(
+				sink->dump,
+				((sink->format == kMonteCarloOutputFormatLZ4) ? (long)sizeof(kLZ4FrameHeader) + 4 : 0) + 16,
+				header + 16,
+				16);
 		}
+
+		closeOutputSink(sink->dump);
 	}
 
-	/*
-	 *	At most two longopt's per demo option (opt and optAlternative) plus zero entry.
-	 */
-	longOptionsSize = optionsSize * 2 + 1;
-	longOptions = (struct option *)checkedCalloc(longOptionsSize, sizeof(struct option), __FILE__, __LINE__);
+	free(sink->hashTable);
+	free(sink->block);
+	free(sink);
 
-	constructlongOptions(options, optionsSize, longOptions, longOptionsSize);
+	return result;
+}
 
-	optind = 0;
-	opterr = 0;
+static void
+saveMonteCarloDataToDataDotOutFile(
+	const void *			benchmarkingDataSamples,
+	FloatingPointVariableType	sampleType,
+	uint64_t			cpuTimeElapsedMicroSeconds,
+	size_t				numberOfMonteCarloIterations)
+{
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseOutput);
+	MonteCarloSampleSink *	sink = startMonteCarloSampleSink(sampleType, true, false, cpuTimeElapsedMicroSeconds, numberOfMonteCarloIterations);
+
+	pushMonteCarloSamples(sink, benchmarkingDataSamples, numberOfMonteCarloIterations);
+	closeMonteCarloSampleSink(sink, cpuTimeElapsedMicroSeconds);
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseOutput);
+}
 
+uint64_t
+nextMonteCarloRandom(MonteCarloRandom *  random)
+{
 	/*
-	 *	From the getopt man page:
-	 *
-	 *	> The variable optind is the index of the next element to be processed in argv.
-	 *
-	 *	Therefore, we remember the previous value of optind which tells us the index of the
-	 *	_current_ index being processed. This is very useful for error messages.
+	 *	xoshiro256** (Blackman and Vigna).
 	 */
-	previousOptInd = 1;
+	uint64_t *	state = random->state;
+	uint64_t	result = state[1] * 5;
+	uint64_t	t = state[1] << 17;
+
+	result = ((result << 7) | (result >> 57)) * 9;
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = (state[3] << 45) | (state[3] >> 19);
+
+	return result;
+}
 
-	while (!error)
+double
+nextMonteCarloUniform(MonteCarloRandom *  random)
+{
+	return (double)(nextMonteCarloRandom(random) >> 11) * 0x1.0p-53;
+}
+
+/*
+ *	Seed `random` for `iteration` of a run seeded with `seed`, by SplitMix64.
+ */
+static void
+seedMonteCarloRandom(MonteCarloRandom *  random, uint64_t  seed, uint64_t  iteration)
+{
+	uint64_t	x = seed ^ (iteration * 0xD1B54A32D192ED03ull);
+
+	for (int i = 0; i < 4; i++)
 	{
-		longIndex = -1;
+		uint64_t	z = (x += 0x9E3779B97F4A7C15ull);
 
-		/*
-		 *	Rather than support both long and short opts (and maintain code to handle
-		 *	both), we only support long opts. However, we use the `_only` form of
-		 *	`getopt_long` which allows users to specify long opts with a single dash.
-		 *
-		 *	Therefore, specify a single character long opt and this will parse short
-		 *	opts as well! The only catch is that you cannot group short opts: something
-		 *	like `-To` must be instead written `-T -o`. I think this is a fine
-		 *	compromise to make.
-		 */
-		modifyNextArgvForNewLibc(argv);
-		opt = getopt_long_only(argc, argv, ":", longOptions, &longIndex);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		random->state[i] = z ^ (z >> 31);
+	}
+}
 
-		if (opt == -1)
+size_t
+getMonteCarloThreadCount(size_t numberOfThreads)
+{
+#ifdef COMMON_HAVE_PTHREADS
+	if (numberOfThreads == 0)
+	{
+		long	onlineProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+
+		numberOfThreads = (onlineProcessors > 0) ? (size_t)onlineProcessors : 1;
+	}
+
+	return numberOfThreads;
+#else
+	(void)numberOfThreads;
+
+	return 1;
+#endif /* COMMON_HAVE_PTHREADS */
+}
+
+enum
+{
+	kMonteCarloRunChunkSize		= 1024,
+	kMonteCarloRunChunksPerThread	= 4,
+};
+
+/*
+ *	A Monte Carlo run is split into chunks of `kMonteCarloRunChunkSize` iterations
+ *	that threads claim in order. Results go to a window of `windowSize` chunk slots
+ *	and are pushed to the sample sink in iteration order, so memory does not grow
+ *	with the number of iterations and the samples file does not depend on the number
+ *	of threads.
+ */
+typedef struct
+{
+	MonteCarloKernel		kernel;
+	void * const *			threadContexts;
+	uint64_t			seed;
+	size_t				numberOfIterations;
+	size_t				numberOfChunks;
+	size_t				windowSize;
+	double *			results;
+	float *				floatResults;
+	MonteCarloSampleSink *		sink;
+#ifdef COMMON_HAVE_PTHREADS
+	bool *				isChunkDone;
+	size_t				nextChunk;
+	size_t				nextChunkToPush;
+	bool				isPushing;
+	pthread_mutex_t			mutex;
+	pthread_cond_t			windowAdvanced;
+#endif /* COMMON_HAVE_PTHREADS */
+} MonteCarloRun;
+
+static void
+computeMonteCarloChunk(MonteCarloRun *  run, size_t  chunk, size_t  threadIndex)
+{
+	double *		results = run->results + (chunk % run->windowSize) * kMonteCarloRunChunkSize;
+	void *			threadContext = (run->threadContexts == NULL) ? NULL : run->threadContexts[threadIndex];
+	size_t			first = chunk * kMonteCarloRunChunkSize;
+	size_t			last = (first + kMonteCarloRunChunkSize < run->numberOfIterations) ? first + kMonteCarloRunChunkSize : run->numberOfIterations;
+	MonteCarloRandom	random;
+
+	for (size_t iteration = first; iteration < last; iteration++)
+	{
+		seedMonteCarloRandom(&random, run->seed, iteration);
+		results[iteration - first] = run->kernel(threadContext, iteration, &random);
+	}
+}
+
+/*
+ *	Push the results of `chunk` to the sample sink. Only one thread pushes at a time.
+ */
+static void
+pushMonteCarloChunk(MonteCarloRun *  run, size_t  chunk)
+{
+	double *	results = run->results + (chunk % run->windowSize) * kMonteCarloRunChunkSize;
+	size_t		first = chunk * kMonteCarloRunChunkSize;
+	size_t		count = (first + kMonteCarloRunChunkSize < run->numberOfIterations) ? kMonteCarloRunChunkSize : run->numberOfIterations - first;
+
+	if (run->floatResults == NULL)
+	{
+		pushMonteCarloSamples(run->sink, results, count);
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		run->floatResults[i] = (float)results[i];
+	}
+	pushMonteCarloSamples(run->sink, run->floatResults, count);
+}
+
+#ifdef COMMON_HAVE_PTHREADS
+typedef struct
+{
+	MonteCarloRun *	run;
+	size_t		threadIndex;
+} MonteCarloRunWorker;
+
+static void *
+runMonteCarloWorker(void *  argument)
+{
+	MonteCarloRunWorker *	worker = (MonteCarloRunWorker *)argument;
+	MonteCarloRun *		run = worker->run;
+
+	pthread_mutex_lock(&run->mutex);
+	for (;;)
+	{
+		size_t	chunk;
+
+		while ((run->nextChunk < run->numberOfChunks) && (run->nextChunk >= run->nextChunkToPush + run->windowSize))
 		{
-			break;
+			pthread_cond_wait(&run->windowAdvanced, &run->mutex);
 		}
 
-		if (longIndex == -1)
+		if (run->nextChunk >= run->numberOfChunks)
 		{
-			/*
-			 *	Error case.
-			 */
-			switch (opt)
-			{
-				case '?':
-				{
-					/*
-					 *	The invalid long opts can be found at
-					 *	`argv[previousOptInd]`. We know the first character
-					 *	when printing will (prior to
-					 *	`modifyNextArgvForNewLibc`) be '-' so we print that
-					 *	explicitly.
-					 */
-					fprintf(stderr, "Error: Invalid option: '-%s' provided.\n", argv[previousOptInd] + 1);
-					break;
-				}
-				case ':':
-				{
-					/*
-					 *	The long opts that is missing an argument can be
-					 *	found at `argv[optind - 1]`. We know the first
-					 *	character when printing will (prior to
-					 *	`modifyNextArgvForNewLibc`) be '-' so we print that
-					 *	explicitly.
-					 */
-					fprintf(stderr, "Error: Option '-%s' is missing mandatory argument.\n", argv[optind - 1] + 1);
-					break;
-				}
-				default:
-				{
-					fprintf(stderr, "Error: Unhandled getopt error return value: -%c.\n", opt);
-					break;
-				}
-			}
-
-			error = true;
 			break;
 		}
 
-		assert(opt >= 0);
-		assert((size_t)opt < optionsSize);
+		chunk = run->nextChunk++;
+		pthread_mutex_unlock(&run->mutex);
+		computeMonteCarloChunk(run, chunk, worker->threadIndex);
+		pthread_mutex_lock(&run->mutex);
 
-		if (options[opt].foundOpt != NULL)
+		run->isChunkDone[chunk % run->windowSize] = true;
+		if (run->isPushing)
 		{
-			*(options[opt].foundOpt) = true;
-		};
+			continue;
+		}
 
-		if (options[opt].hasArg)
+		/*
+		 *	The slot of a chunk is not reused before the chunk is pushed, so the
+		 *	results can be pushed without holding the mutex.
+		 */
+		run->isPushing = true;
+		while ((run->nextChunkToPush < run->numberOfChunks) && run->isChunkDone[run->nextChunkToPush % run->windowSize])
 		{
-			if (optarg == NULL)
-			{
-				fatal("Internal error: option -%s missing argument.", longOptions[longIndex].name);
-			}
+			size_t	chunkToPush = run->nextChunkToPush;
 
-			if (options[opt].foundArg != NULL)
-			{
-				*(options[opt].foundArg) = optarg;
-			}
+			pthread_mutex_unlock(&run->mutex);
+			pushMonteCarloChunk(run, chunkToPush);
+			pthread_mutex_lock(&run->mutex);
+
+			run->isChunkDone[chunkToPush % run->windowSize] = false;
+			run->nextChunkToPush++;
+			pthread_cond_broadcast(&run->windowAdvanced);
 		}
+		run->isPushing = false;
+	}
+	pthread_mutex_unlock(&run->mutex);
 
-		previousOptInd = optind;
+	return NULL;
+}
+#endif /* COMMON_HAVE_PTHREADS */
+
+CommonConstantReturnType
+runMonteCarloIterations(
+	MonteCarloKernel		kernel,
+	void * const *			threadContexts,
+	size_t				numberOfThreads,
+	size_t				numberOfIterations,
+	uint64_t			seed,
+	FloatingPointVariableType	sampleType,
+	bool				isDumpEnabled,
+	MonteCarloRunResult *		result)
+{
+	MonteCarloRun	run = {
+				.kernel = kernel,
+				.threadContexts = threadContexts,
+				.seed = seed,
+				.numberOfIterations = numberOfIterations,
+				.numberOfChunks = (numberOfIterations + kMonteCarloRunChunkSize - 1) / kMonteCarloRunChunkSize,
+			};
+	uint64_t	wallTimeStart = getMonotonicMicroseconds();
+	clock_t		cpuTimeStart = clock();
+
+	if ((kernel == NULL) || (result == NULL)
+		|| ((sampleType != kFloatingPointVariableTypeFloat) && (sampleType != kFloatingPointVariableTypeDouble)))
+	{
+		fprintf(stderr, "Error: Invalid arguments to runMonteCarloIterations().\n");
+
+		return kCommonConstantReturnTypeError;
+	}
+
+	numberOfThreads = getMonteCarloThreadCount(numberOfThreads);
+	run.windowSize = numberOfThreads * kMonteCarloRunChunksPerThread;
+	run.results = (double *)checkedMalloc(run.windowSize * kMonteCarloRunChunkSize * sizeof(double), __FILE__, __LINE__);
+	if (sampleType == kFloatingPointVariableTypeFloat)
+	{
+		run.floatResults = (float *)checkedMalloc(kMonteCarloRunChunkSize * sizeof(float), __FILE__, __LINE__);
+	}
+	run.sink = openMonteCarloSampleSink(sampleType, isDumpEnabled);
+
+#ifdef COMMON_HAVE_PTHREADS
+	pthread_t *		threads = (pthread_t *)checkedCalloc(numberOfThreads, sizeof(pthread_t), __FILE__, __LINE__);
+	bool *			isThreadStarted = (bool *)checkedCalloc(numberOfThreads, sizeof(bool), __FILE__, __LINE__);
+	MonteCarloRunWorker *	workers = (MonteCarloRunWorker *)checkedCalloc(numberOfThreads, sizeof(MonteCarloRunWorker), __FILE__, __LINE__);
+
+	run.isChunkDone = (bool *)checkedCalloc(run.windowSize, sizeof(bool), __FILE__, __LINE__);
+	pthread_mutex_init(&run.mutex, NULL);
+	pthread_cond_init(&run.windowAdvanced, NULL);
+
+	/*
+	 *	The calling thread is worker 0. Should a thread fail to start, the others do
+	 *	its share.
+	 */
+	for (size_t i = 0; i < numberOfThreads; i++)
+	{
+		workers[i] = (MonteCarloRunWorker){ .run = &run, .threadIndex = i };
+	}
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseKernel);
+	for (size_t i = 1; i < numberOfThreads; i++)
+	{
+		isThreadStarted[i] = (pthread_create(&threads[i], NULL, runMonteCarloWorker, &workers[i]) == 0);
 	}
+	runMonteCarloWorker(&workers[0]);
+	for (size_t i = 1; i < numberOfThreads; i++)
+	{
+		if (isThreadStarted[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseKernel);
+
+	pthread_cond_destroy(&run.windowAdvanced);
+	pthread_mutex_destroy(&run.mutex);
+	free(run.isChunkDone);
+	free(workers);
+	free(isThreadStarted);
+	free(threads);
+#else
+	COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseKernel);
+	for (size_t chunk = 0; chunk < run.numberOfChunks; chunk++)
+	{
+		computeMonteCarloChunk(&run, chunk, 0);
+		pushMonteCarloChunk(&run, chunk);
+	}
+	COMMON_INSTRUMENT_END(kInstrumentationPhaseKernel);
+#endif /* COMMON_HAVE_PTHREADS */
+
+	*result = (MonteCarloRunResult) {
+		.numberOfThreads = numberOfThreads,
+		.wallTimeElapsedMicroSeconds = getMonotonicMicroseconds() - wallTimeStart,
+		.cpuTimeElapsedMicroSeconds = (uint64_t)(clock() - cpuTimeStart) * 1000000 / CLOCKS_PER_SEC,
+	};
+	result->meanAndVariance = closeMonteCarloSampleSink(run.sink, result->cpuTimeElapsedMicroSeconds);
+
+	free(run.floatResults);
+	free(run.results);
+
+	return kCommonConstantReturnTypeSuccess;
+}
+
+void
+saveMonteCarloFloatDataToDataDotOutFile(
+	const float *	benchmarkingDataSamples,
+	uint64_t	cpuTimeElapsedMicroSeconds,
+	size_t		numberOfMonteCarloIterations)
+{
+	saveMonteCarloDataToDataDotOutFile(
+		benchmarkingDataSamples,
+		kFloatingPointVariableTypeFloat,
+		cpuTimeElapsedMicroSeconds,
+		numberOfMonteCarloIterations);
+}
+
+void
+saveMonteCarloDoubleDataToDataDotOutFile(
+	const double *	benchmarkingDataSamples,
+	uint64_t	cpuTimeElapsedMicroSeconds,
+	size_t		numberOfMonteCarloIterations)
+{
+	saveMonteCarloDataToDataDotOutFile(
+		benchmarkingDataSamples,
+		kFloatingPointVariableTypeDouble,
+		cpuTimeElapsedMicroSeconds,
+		numberOfMonteCarloIterations);
+}
+
+enum
+{
+	kBenchmarkCycleCounterCalibrationNanoseconds	= 10 * 1000 * 1000,
+};
+
+/*
+ *	Two-sided 95% quantiles of Student's t-distribution for 1 to 30 degrees of
+ *	freedom. Beyond that the normal quantile is close enough.
+ */
+static const double	kBenchmarkStudentT95[] = {
+				12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+				2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+				2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+			};
+
+/*
+ *	Read the cycle counter into `ticks`. Returns false where there is none. The
+ *	counter is assumed to tick at a constant rate (an invariant TSC on x86).
+ */
+static bool
+readCycleCounter(uint64_t *  ticks)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	*ticks = __builtin_ia32_rdtsc();
+
+	return true;
+#elif defined(__aarch64__)
+	uint64_t	counter;
 
-	if (!error && optind < argc)
-	{
-		fprintf(stderr, "Error: Unexpected argument '%s'\n", argv[optind]);
-		error = true;
-	}
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r"(counter));
+	*ticks = counter;
 
-	free(longOptions);
+	return true;
+#else
+	(void)ticks;
 
-	return(error ? kCommonConstantReturnTypeError : kCommonConstantReturnTypeSuccess);
+	return false;
+#endif
 }
 
-
-static CommonConstantReturnType
-concatAndParseArgs(
-	int		argc,
-	char *  const	argv[],
-	DemoOption *	demoSpecificOptions,
-	DemoOption *	commonOptions)
+/*
+ *	Cycle counter ticks per microsecond, measured against the monotonic clock on first
+ *	use, or 0 if there is no cycle counter.
+ */
+static double
+getCycleCounterTicksPerMicrosecond(void)
 {
-	size_t				demoSpecificOptionsSize = 0;
-	size_t				commonOptionsSize = 0;
-	size_t				concatOptionsSize;
-	DemoOption *			concatOptions = NULL;
-	CommonConstantReturnType	ret;
+	static double	ticksPerMicrosecond = -1;
+	uint64_t	startTicks;
+	uint64_t	endTicks;
+	uint64_t	startNanoseconds;
+	uint64_t	endNanoseconds;
 
-	while ((demoSpecificOptions[demoSpecificOptionsSize].opt != NULL) || (demoSpecificOptions[demoSpecificOptionsSize].optAlternative != NULL))
+	if (ticksPerMicrosecond >= 0)
 	{
-		demoSpecificOptionsSize++;
+		return ticksPerMicrosecond;
 	}
 
-	while ((commonOptions[commonOptionsSize].opt != NULL) || (commonOptions[commonOptionsSize].optAlternative != NULL))
+	ticksPerMicrosecond = 0;
+	if (!readCycleCounter(&startTicks))
 	{
-		commonOptionsSize++;
+		return ticksPerMicrosecond;
 	}
 
-	concatOptionsSize = demoSpecificOptionsSize + commonOptionsSize;
-	concatOptions = (DemoOption *)checkedCalloc(concatOptionsSize, sizeof(DemoOption), __FILE__, __LINE__);
-
-	memcpy(
-		concatOptions,
-		demoSpecificOptions,
-		sizeof(DemoOption) * demoSpecificOptionsSize);
+	startNanoseconds = getMonotonicNanoseconds();
+	do
+	{
+		endNanoseconds = getMonotonicNanoseconds();
+	} while (endNanoseconds - startNanoseconds < kBenchmarkCycleCounterCalibrationNanoseconds);
+	readCycleCounter(&endTicks);
 
-	memcpy(
-		concatOptions + demoSpecificOptionsSize,
-		commonOptions,
-		sizeof(DemoOption) * commonOptionsSize);
+	ticksPerMicrosecond = (double)(endTicks - startTicks) * 1000 / (double)(endNanoseconds - startNanoseconds);
 
-	ret = parseArgsCoreImplementation(argc, argv, concatOptions, concatOptionsSize);
+	return ticksPerMicrosecond;
+}
 
-	free(concatOptions);
+/*
+ *	Half-width of the 95% confidence interval of the mean of `count` trials with
+ *	population variance `variance`.
+ */
+static double
+getBenchmarkConfidenceInterval(double  variance, size_t  count)
+{
+	size_t	degreesOfFreedom = count - 1;
+	double	t = (degreesOfFreedom <= sizeof(kBenchmarkStudentT95) / sizeof(kBenchmarkStudentT95[0]))
+			? kBenchmarkStudentT95[degreesOfFreedom - 1]
+			: 1.96;
 
-	return ret;
+	return t * sqrt(variance / (double)degreesOfFreedom);
 }
 
-CommonConstantReturnType
-parseArgs(
-	int				argc,
-	char *  const 			argv[],
-	CommonCommandLineArguments *	arguments,
-	DemoOption *			demoSpecificOptions)
+/*
+ *	Time one call of `function` in microseconds.
+ */
+static double
+timeBenchmarkTrial(BenchmarkFunction  function, void *  context, bool  isCycleCounter, double  ticksPerMicrosecond)
 {
-	assert(arguments != NULL);
+	uint64_t	start;
+	uint64_t	end;
 
-	setDefaultCommandLineArgumentValues(arguments);
+	if (isCycleCounter)
+	{
+		readCycleCounter(&start);
+		function(context);
+		readCycleCounter(&end);
 
-	const char *	inputArg = NULL;
-	const char *	outputArg = NULL;
-	const char *	outputSelectArg = NULL;
-	const char *	multipleExecutionsArg = NULL;
-	DemoOption	commonOptions[] = {
-						{ "input",			"i",	true,	&inputArg,		NULL },
-						{ "output",			"o",	true,	&outputArg,		NULL },
-						{ "select-output",		"S",	true,	&outputSelectArg,	NULL },
-						{ "time",			"T",	false,	NULL,			&arguments->isTimingEnabled },
-						{ "multiple-executions",	"M",	true,	&multipleExecutionsArg,	NULL },
-						{ "verbose",			"v",	false,	NULL,			&arguments->isVerbose },
-						{ "json",			"j",	false,	NULL,			&arguments->isOutputJSONMode },
-						{ "help",			"h",	false,	NULL,			&arguments->isHelpEnabled },
-						{ "benchmarking",		"b",	false,	NULL,			&arguments->isBenchmarkingMode },
-						{ ZERO_STRUCT_INIT }
-					};
+		return (double)(end - start) / ticksPerMicrosecond;
+	}
 
-	if (concatAndParseArgs(argc, argv, demoSpecificOptions, commonOptions) != kCommonConstantReturnTypeSuccess)
+	start = getMonotonicNanoseconds();
+	function(context);
+	end = getMonotonicNanoseconds();
+
+	return (double)(end - start) / 1000;
+}
+
+static const char *	kPerformanceCounterNames[kPerformanceCounterMax] = {
+				[kPerformanceCounterCycles]		= "cycles",
+				[kPerformanceCounterInstructions]	= "instructions",
+				[kPerformanceCounterLLCMisses]		= "llcMisses",
+				[kPerformanceCounterBranchMisses]	= "branchMisses",
+			};
+
+/*
+ *	Open a counter of the calling thread for each `PerformanceCounter`, disabled and
+ *	counting user space only. A counter that cannot be opened, for example because a
+ *	container or `perf_event_paranoid` forbids it, gets a descriptor of -1.
+ */
+static void
+openPerformanceCounters(int  fds[kPerformanceCounterMax])
+{
+#ifdef COMMON_HAVE_PERF_EVENTS
+	static const uint64_t	kHardwareEvents[kPerformanceCounterMax] = {
+					[kPerformanceCounterCycles]		= PERF_COUNT_HW_CPU_CYCLES,
+					[kPerformanceCounterInstructions]	= PERF_COUNT_HW_INSTRUCTIONS,
+					[kPerformanceCounterLLCMisses]		= PERF_COUNT_HW_CACHE_MISSES,
+					[kPerformanceCounterBranchMisses]	= PERF_COUNT_HW_BRANCH_MISSES,
+				};
+
+	for (int i = 0; i < kPerformanceCounterMax; i++)
 	{
-		return kCommonConstantReturnTypeError;
+		struct perf_event_attr	attributes;
+
+		memset(&attributes, 0, sizeof(attributes));
+		attributes.size = sizeof(attributes);
+		attributes.type = PERF_TYPE_HARDWARE;
+		attributes.config = kHardwareEvents[i];
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		fds[i] = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
 	}
-
-	if (inputArg != NULL)
+#else
+	for (int i = 0; i < kPerformanceCounterMax; i++)
 	{
-		int ret = snprintf(arguments->inputFilePath, kCommonConstantMaxCharsPerFilepath, "%s", inputArg);
-
-		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
-		{
-			fprintf(stderr, "Error: Could not read input file path from command-line arguments.\n");
-			return kCommonConstantReturnTypeError;
-		}
-		else
-		{
-			arguments->isInputFromFileEnabled = true;
-		}
+		fds[i] = -1;
 	}
+#endif /* COMMON_HAVE_PERF_EVENTS */
+}
 
-	if (outputArg != NULL)
+static void
+setPerformanceCountersEnabled(const int  fds[kPerformanceCounterMax], bool  isEnabled)
+{
+#ifdef COMMON_HAVE_PERF_EVENTS
+	for (int i = 0; i < kPerformanceCounterMax; i++)
 	{
-		int ret = snprintf(arguments->outputFilePath, kCommonConstantMaxCharsPerFilepath, "%s", outputArg);
-
-		if ((ret < 0) || (ret >= kCommonConstantMaxCharsPerFilepath))
-		{
-			fprintf(stderr, "Error: Could not read output file path from command-line arguments.\n");
-			return kCommonConstantReturnTypeError;
-		}
-		else
+		if (fds[i] >= 0)
 		{
-			arguments->isWriteToFileEnabled = true;
+			ioctl(fds[i], isEnabled ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
 		}
 	}
+#else
+	(void)fds;
+	(void)isEnabled;
+#endif /* COMMON_HAVE_PERF_EVENTS */
+}
 
-	if (outputSelectArg != NULL)
+/*
+ *	Read and close the counters. Counts are scaled up for the time a counter was
+ *	multiplexed out. A counter that never ran is unavailable.
+ */
+static void
+closePerformanceCounters(int  fds[kPerformanceCounterMax], PerformanceCounterValues *  values)
+{
+	*values = (PerformanceCounterValues){ .isAvailable = { false } };
+
+#ifdef COMMON_HAVE_PERF_EVENTS
+	for (int i = 0; i < kPerformanceCounterMax; i++)
 	{
-		int	outputSelect;
-		int	ret = parseIntChecked(outputSelectArg, &outputSelect);
+		uint64_t	reading[3];
 
-		if (ret != kCommonConstantReturnTypeSuccess)
+		if (fds[i] < 0)
 		{
-			fprintf(stderr, "Error: The output selected must be an integer.\n");
-
-			return kCommonConstantReturnTypeError;
+			continue;
 		}
-		else if (outputSelect < 0)
-		{
-			fprintf(stderr, "Error: The output selected must be non-negative.\n");
 
-			return kCommonConstantReturnTypeError;
-		}
-		else
+		/*
+		 *	The value, the time enabled and the time running.
+		 */
+		if ((read(fds[i], reading, sizeof(reading)) == (ssize_t)sizeof(reading)) && (reading[2] > 0))
 		{
-			arguments->outputSelect = outputSelect;
-			arguments->isOutputSelected = true;
+			values->isAvailable[i] = true;
+			values->counts[i] = (reading[2] < reading[1])
+						? (uint64_t)((double)reading[0] * (double)reading[1] / (double)reading[2])
+						: reading[0];
 		}
+		close(fds[i]);
+		fds[i] = -1;
 	}
+#else
+	(void)fds;
+#endif /* COMMON_HAVE_PERF_EVENTS */
+}
 
-	if (multipleExecutionsArg != NULL)
-	{
-		int	multipleExecutions;
-		int	ret = parseIntChecked(multipleExecutionsArg, &multipleExecutions);
-
-		if (ret != kCommonConstantReturnTypeSuccess)
-		{
-			fprintf(stderr, "Error: The number of multiple executions must be an integer.\n");
-
-			return kCommonConstantReturnTypeError;
-		}
-		else if (multipleExecutions <= 0)
-		{
-			fprintf(stderr, "Error: The number of multiple executions must be positive.\n");
+static int
+compareDoubles(const void *  a, const void *  b)
+{
+	double	x = *(const double *)a;
+	double	y = *(const double *)b;
 
-			return kCommonConstantReturnTypeError;
-		}
-		else
-		{
-			arguments->numberOfMonteCarloIterations = multipleExecutions;
+	return (x > y) - (x < y);
+}
 
-			arguments->isMonteCarloMode = true;
-			arguments->isTimingEnabled = true;
-			arguments->isSingleShotExecution = false;
-		}
-	}
+/*
+ *	The `percentile`th percentile of the `count` sorted values, interpolating
+ *	linearly between ranks.
+ */
+static double
+getSortedPercentile(const double *  sorted, size_t  count, double  percentile)
+{
+	double	rank = percentile / 100 * (double)(count - 1);
+	size_t	lower = (size_t)rank;
 
-	/*
-	 *	JSON output mode and benchmarking mode are not compatible.
-	 */
-	if ((arguments->isOutputJSONMode) && (arguments->isBenchmarkingMode))
+	if (lower + 1 >= count)
 	{
-		fprintf(stderr, "Error: Output JSON mode and benchmarking mode are not compatible. Please choose only one.\n");
-
-		return kCommonConstantReturnTypeError;
+		return sorted[count - 1];
 	}
 
-	return kCommonConstantReturnTypeSuccess;
+	return sorted[lower] + (rank - (double)lower) * (sorted[lower + 1] - sorted[lower]);
 }
 
 void
-printCommonUsage(void)
+getDefaultBenchmarkOptions(BenchmarkOptions *  options)
 {
-	fprintf(stderr, "Usage: Valid command-line arguments are:\n");
-	fprintf(
-		stderr,
-		"\t[-i, --input <Path to input CSV file : str>] (Read inputs from file.)\n"
-		"\t[-o, --output <Path to output CSV file : str>] (Specify the output file.)\n"
-		"\t[-S, --select-output <output : int>] (Compute 0-indexed output, by default 0.)\n"
-		"\t[-M, --multiple-executions <Number of executions : int (Default: 1)>] (Repeated execute kernel for benchmarking.)\n"
-		"\t[-T, --time] (Timing mode: Times and prints the timing of the kernel execution.)\n"
-		"\t[-v, --verbose] (Verbose mode: Prints extra information about demo execution.)\n"
-		"\t[-b, --benchmarking] (Benchmarking mode: Generate outputs in format for benchmarking.)\n"
-		"\t[-j, --json] (Print output in JSON format.)\n"
-		"\t[-h, --help] (Display this help message.)\n");
+	*options = (BenchmarkOptions) {
+		.clock					= kBenchmarkClockMonotonic,
+		.numberOfWarmUpTrials			= 3,
+		.minimumNumberOfTrials			= 10,
+		.maximumNumberOfTrials			= 10000,
+		.targetRelativeConfidenceInterval	= 0.01,
+		.maximumTotalMicroseconds		= 10 * 1000000,
+		.isPerformanceCountersEnabled		= false,
+		.bytesPerTrial				= 0,
+		.itemsPerTrial				= 0,
+	};
 }
 
-MeanAndVariance
-calculateMeanAndVarianceOfFloatSamples(
-	const float *	dataArray,
-	size_t		dataArraySize)
+/*
+ *	Peak resident set size of the process, in bytes. Returns false where it is not known.
+ */
+static bool
+getPeakResidentBytes(uint64_t *  peakResidentBytes)
 {
-	float	mean;
-	float	variance;
-	float	sum = 0;
-	float	sumOfSquares = 0;
+#ifdef COMMON_HAVE_GETRUSAGE
+	struct rusage	usage;
 
-	for (size_t i = 0; i < dataArraySize; i++)
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
 	{
-		sum += dataArray[i];
-		sumOfSquares += dataArray[i] * dataArray[i];
+		return false;
 	}
 
-	mean = sum / dataArraySize;
-	variance = sumOfSquares / dataArraySize - (mean * mean);
+	/*
+	 *	`ru_maxrss` is in bytes on macOS and in KiB elsewhere.
+	 */
+#if defined(__APPLE__)
+	*peakResidentBytes = (uint64_t)usage.ru_maxrss;
+#else
+	*peakResidentBytes = (uint64_t)usage.ru_maxrss * 1024;
+#endif
+
+	return true;
+#else
+	(void)peakResidentBytes;
 
-	return (MeanAndVariance)
-	{
-		.mean = (double)mean,
-		.variance = (double)variance,
-	};
+	return false;
+#endif /* COMMON_HAVE_GETRUSAGE */
 }
 
-MeanAndVariance
-calculateMeanAndVarianceOfDoubleSamples(
-	const double *	dataArray,
-	size_t		dataArraySize)
+CommonConstantReturnType
+runBenchmark(
+	BenchmarkFunction		function,
+	void *				context,
+	const BenchmarkOptions *	options,
+	BenchmarkResult *		result)
 {
-	double	mean;
-	double	variance;
-	double	sum = 0;
-	double	sumOfSquares = 0;
+	double *	trials;
+	double		ticksPerMicrosecond = 0;
+	bool		isCycleCounter = false;
+	double		totalMicroseconds = 0;
+	size_t		count = 0;
+	SampleMoments	moments;
+	double		confidenceInterval;
+	int		performanceCounterFds[kPerformanceCounterMax];
+
+	if ((function == NULL) || (options == NULL) || (result == NULL)
+		|| (options->minimumNumberOfTrials == 0) || (options->maximumNumberOfTrials < options->minimumNumberOfTrials))
+	{
+		fprintf(stderr, "Error: Invalid arguments to runBenchmark().\n");
+
+		return kCommonConstantReturnTypeError;
+	}
 
-	for (size_t i = 0; i < dataArraySize; i++)
+	if (options->clock == kBenchmarkClockCycleCounter)
 	{
-		sum += dataArray[i];
-		sumOfSquares += dataArray[i] * dataArray[i];
+		ticksPerMicrosecond = getCycleCounterTicksPerMicrosecond();
+		isCycleCounter = (ticksPerMicrosecond > 0);
 	}
 
-	mean = sum / dataArraySize;
-	variance = sumOfSquares / dataArraySize - (mean * mean);
+	for (size_t i = 0; i < options->numberOfWarmUpTrials; i++)
+	{
+		function(context);
+	}
 
-	return (MeanAndVariance)
+	trials = (double *)checkedMalloc(options->maximumNumberOfTrials * sizeof(double), __FILE__, __LINE__);
+	*result = (BenchmarkResult){ .isConverged = false };
+	if (options->isPerformanceCountersEnabled)
 	{
-		.mean = mean,
-		.variance = variance,
-	};
-}
+		openPerformanceCounters(performanceCounterFds);
+	}
 
-void
-saveMonteCarloFloatDataToDataDotOutFile(
-	const float *	benchmarkingDataSamples,
-	uint64_t	cpuTimeElapsedMicroSeconds,
-	size_t		numberOfMonteCarloIterations)
-{
-	FILE *	fp = fopen("data.out", "w");
-	if (fp == NULL)
+	/*
+	 *	Stop once the 95% confidence interval of the mean is narrow enough, or when
+	 *	running out of trials or time.
+	 */
+	while (count < options->maximumNumberOfTrials)
 	{
-		fatal("Could not open monte carlo output file");
+		if (options->isPerformanceCountersEnabled)
+		{
+			setPerformanceCountersEnabled(performanceCounterFds, true);
+			trials[count] = timeBenchmarkTrial(function, context, isCycleCounter, ticksPerMicrosecond);
+			setPerformanceCountersEnabled(performanceCounterFds, false);
+		}
+		else
+		{
+			trials[count] = timeBenchmarkTrial(function, context, isCycleCounter, ticksPerMicrosecond);
+		}
+		totalMicroseconds += trials[count];
+		count++;
+
+		if ((count < options->minimumNumberOfTrials) || (count < 2))
+		{
+			continue;
+		}
+
+		moments = calculateMomentsOfDoubleSamples(trials, count);
+		if (getBenchmarkConfidenceInterval(moments.variance, count) <= options->targetRelativeConfidenceInterval * moments.mean)
+		{
+			result->isConverged = true;
+			break;
+		}
+
+		if ((options->maximumTotalMicroseconds > 0) && (totalMicroseconds >= (double)options->maximumTotalMicroseconds))
+		{
+			break;
+		}
 	}
 
-	fprintf(fp, "%" PRIu64 "\n", cpuTimeElapsedMicroSeconds);
+	moments = calculateMomentsOfDoubleSamples(trials, count);
+	confidenceInterval = (count > 1) ? getBenchmarkConfidenceInterval(moments.variance, count) : 0;
 
-	for (size_t i = 0; i < numberOfMonteCarloIterations; i++)
+	if (options->isPerformanceCountersEnabled)
 	{
-		fprintf(fp, "%.20f\n", benchmarkingDataSamples[i]);
+		closePerformanceCounters(performanceCounterFds, &result->performanceCounters);
 	}
 
-	fclose(fp);
+	qsort(trials, count, sizeof(double), compareDoubles);
+
+	result->clock = isCycleCounter ? kBenchmarkClockCycleCounter : kBenchmarkClockMonotonic;
+	result->numberOfTrials = count;
+	result->meanMicroseconds = moments.mean;
+	result->standardDeviationMicroseconds = sqrt(moments.variance);
+	result->confidenceIntervalMicroseconds = confidenceInterval;
+	result->minMicroseconds = trials[0];
+	result->medianMicroseconds = getSortedPercentile(trials, count, 50);
+	result->p95Microseconds = getSortedPercentile(trials, count, 95);
+	result->p99Microseconds = getSortedPercentile(trials, count, 99);
+	result->maxMicroseconds = trials[count - 1];
+	if (result->medianMicroseconds > 0)
+	{
+		result->bytesPerSecond = (double)options->bytesPerTrial * 1e6 / result->medianMicroseconds;
+		result->itemsPerSecond = (double)options->itemsPerTrial * 1e6 / result->medianMicroseconds;
+	}
+	result->isPeakResidentBytesAvailable = getPeakResidentBytes(&result->peakResidentBytes);
+
+	free(trials);
+
+	return kCommonConstantReturnTypeSuccess;
 }
 
 void
-saveMonteCarloDoubleDataToDataDotOutFile(
-	const double *	benchmarkingDataSamples,
-	uint64_t	cpuTimeElapsedMicroSeconds,
-	size_t		numberOfMonteCarloIterations)
+printBenchmarkResult(const char *  name, const BenchmarkResult *  result)
 {
-	FILE *	fp = fopen("data.out", "w");
-	if (fp == NULL)
+	OutputSink *	sink = openOutputSink(NULL, "w");
+	OutputBuffer *	buffer = getOutputSinkBuffer(sink);
+
+	appendOutputBufferFormat(
+		buffer,
+		"{\"name\": \"%s\", \"clock\": \"%s\", \"trials\": %zu, \"converged\": %s, "
+		"\"meanMicroseconds\": %.3f, \"stdDevMicroseconds\": %.3f, \"ci95Microseconds\": %.3f, "
+		"\"minMicroseconds\": %.3f, \"medianMicroseconds\": %.3f, \"p95Microseconds\": %.3f, "
+		"\"p99Microseconds\": %.3f, \"maxMicroseconds\": %.3f",
+		name,
+		(result->clock == kBenchmarkClockCycleCounter) ? "cycle-counter" : "monotonic",
+		result->numberOfTrials,
+		result->isConverged ? "true" : "false",
+		result->meanMicroseconds,
+		result->standardDeviationMicroseconds,
+		result->confidenceIntervalMicroseconds,
+		result->minMicroseconds,
+		result->medianMicroseconds,
+		result->p95Microseconds,
+		result->p99Microseconds,
+		result->maxMicroseconds);
+
+	appendOutputBufferString(buffer, ", \"bytesPerSecond\": ");
+	if (result->bytesPerSecond > 0)
 	{
-		fatal("Could not open monte carlo output file");
+		appendOutputBufferFormat(buffer, "%.1f", result->bytesPerSecond);
+	}
+	else
+	{
+		appendOutputBufferString(buffer, "null");
+	}
+	appendOutputBufferString(buffer, ", \"itemsPerSecond\": ");
+	if (result->itemsPerSecond > 0)
+	{
+		appendOutputBufferFormat(buffer, "%.1f", result->itemsPerSecond);
+	}
+	else
+	{
+		appendOutputBufferString(buffer, "null");
+	}
+	appendOutputBufferString(buffer, ", \"peakResidentBytes\": ");
+	if (result->isPeakResidentBytesAvailable)
+	{
+		appendOutputBufferFormat(buffer, "%" PRIu64, result->peakResidentBytes);
+	}
+	else
+	{
+		appendOutputBufferString(buffer, "null");
 	}
 
-	fprintf(fp, "%" PRIu64 "\n", cpuTimeElapsedMicroSeconds);
-
-	for (size_t i = 0; i < numberOfMonteCarloIterations; i++)
+	/*
+	 *	Counts are per trial, and `null` where the counter is not available.
+	 */
+	for (int i = 0; i < kPerformanceCounterMax; i++)
 	{
-		fprintf(fp, "%.20lf\n", benchmarkingDataSamples[i]);
+		appendOutputBufferFormat(buffer, ", \"%sPerTrial\": ", kPerformanceCounterNames[i]);
+		if (result->performanceCounters.isAvailable[i] && (result->numberOfTrials > 0))
+		{
+			appendOutputBufferFormat(buffer, "%.1f", (double)result->performanceCounters.counts[i] / (double)result->numberOfTrials);
+		}
+		else
+		{
+			appendOutputBufferString(buffer, "null");
+		}
 	}
+	appendOutputBufferString(buffer, "}\n");
 
-	fclose(fp);
+	closeOutputSink(sink);
 }
 
 void *
@@ -1456,6 +9876,8 @@ checkedMalloc(size_t size, const char *  file, int line)
 	{
 		fatal("malloc() failed to allocate %zu bytes at %s:%d", size, file, line);
 	}
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterAllocations, 1);
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesAllocated, size);
 
 	return ret;
 }
@@ -1468,6 +9890,27 @@ checkedCalloc(size_t count, size_t size, const char *  file, int line)
 	{
 		fatal("calloc() failed to allocate %zu bytes at %s:%d", count * size, file, line);
 	}
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterAllocations, 1);
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesAllocated, count * size);
+
+	return ret;
+}
+
+void *
+checkedAlignedMalloc(size_t alignment, size_t size, const char *  file, int line)
+{
+	void *	ret = NULL;
+
+	/*
+	 *	`posix_memalign()` rather than the C11 `aligned_alloc()`, which a C99 build does
+	 *	not declare.
+	 */
+	if (posix_memalign(&ret, alignment, (size > 0) ? size : alignment) != 0)
+	{
+		fatal("posix_memalign() failed to allocate %zu bytes at %s:%d", size, file, line);
+	}
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterAllocations, 1);
+	COMMON_INSTRUMENT_COUNT(kInstrumentationCounterBytesAllocated, size);
 
 	return ret;
 }
@@ -44,6 +44,8 @@ typedef enum
 	kCommonConstantMaxNumberOfInputSamples			= 10000,
 	kCommonConstantMaxCharsPerJSONVariableSymbol		= 256,
 	kCommonConstantMaxCharsPerJSONVariableDescription	= 1024,
+	kCommonConstantMinCharsPerCSVParsingThread		= 256 * 1024,
+	kCommonConstantSampleColumnsAlignment			= 64,
 } CommonConstant;
 
 typedef enum
@@ -59,6 +61,44 @@ typedef enum
 	kFloatingPointVariableTypeDouble,
 } FloatingPointVariableType;
 
+typedef enum
+{
+	kInputFileFormatCSV,
+	kInputFileFormatBinaryColumns,
+} InputFileFormat;
+
+typedef enum
+{
+	kMonteCarloOutputFormatText,
+	kMonteCarloOutputFormatBinary,
+	kMonteCarloOutputFormatLZ4,
+} MonteCarloOutputFormat;
+
+typedef enum
+{
+	kJSONParticleEncodingText,
+	kJSONParticleEncodingBase64,
+} JSONParticleEncoding;
+
+typedef enum
+{
+	kInstrumentationPhaseInputParsing,
+	kInstrumentationPhaseDistributionConstruction,
+	kInstrumentationPhaseKernel,
+	kInstrumentationPhaseOutput,
+	kInstrumentationPhaseMax,
+} InstrumentationPhase;
+
+typedef enum
+{
+	kInstrumentationCounterBytesRead,
+	kInstrumentationCounterRowsParsed,
+	kInstrumentationCounterAllocations,
+	kInstrumentationCounterBytesAllocated,
+	kInstrumentationCounterOutputBytes,
+	kInstrumentationCounterMax,
+} InstrumentationCounter;
+
 typedef enum
 {
 	kJSONVariableTypeUnknown,
@@ -93,6 +133,75 @@ void
 doNotOptimize(void *  ptr);
 
 
+/**
+ *	@brief	Start timing a phase, see `COMMON_INSTRUMENT_BEGIN`.
+ *
+ *	@return	The start time
+ */
+uint64_t
+beginInstrumentedPhase(void);
+
+/**
+ *	@brief	Add the time since `startNanoseconds` to `phase`, see `COMMON_INSTRUMENT_END`.
+ *
+ *	@param	phase			Phase to add to
+ *	@param	startNanoseconds	Start time returned by `beginInstrumentedPhase()`
+ */
+void
+endInstrumentedPhase(
+	InstrumentationPhase	phase,
+	uint64_t		startNanoseconds);
+
+/**
+ *	@brief	Add `amount` to `counter`, see `COMMON_INSTRUMENT_COUNT`.
+ *
+ *	@param	counter	Counter to add to
+ *	@param	amount	Amount to add
+ */
+void
+addInstrumentationCount(
+	InstrumentationCounter	counter,
+	uint64_t		amount);
+
+/**
+ *	@brief	Print the time spent in each phase and the counters to the standard error,
+ *		as a table or as a one-line JSON object.
+ *
+ *	@details When built with `COMMON_ENABLE_INSTRUMENTATION`, `parseArgs()` arranges
+ *	for this to run at exit under `-v` or `-T`, in JSON under `-j`.
+ *
+ *	@param	isJSON	Whether to print JSON instead of a table
+ */
+void
+printInstrumentationSummary(bool  isJSON);
+
+/*
+ *	Time the statements between
+ *
+ *		COMMON_INSTRUMENT_BEGIN(kInstrumentationPhaseKernel);
+ *		...
+ *		COMMON_INSTRUMENT_END(kInstrumentationPhaseKernel);
+ *
+ *	in `phase`, which must be named by its enumerator. The two must be in the same
+ *	block, and each phase can be begun once per block: `COMMON_INSTRUMENT_BEGIN`
+ *	declares the start time that `COMMON_INSTRUMENT_END` reads, so an unmatched
+ *	`COMMON_INSTRUMENT_END` does not compile. Nothing wraps the statements, so `break`
+ *	and `continue` between the two act on the enclosing loop as usual; leaving with
+ *	`break`, `return` or `goto` skips the timing. Count `amount` in `counter` with
+ *	COMMON_INSTRUMENT_COUNT(counter, amount). All compile to nothing unless
+ *	`COMMON_ENABLE_INSTRUMENTATION` is defined. The library's own input, distribution
+ *	construction and output routines are instrumented when it is built with it.
+ */
+#ifdef COMMON_ENABLE_INSTRUMENTATION
+#define COMMON_INSTRUMENT_BEGIN(phase)			const uint64_t commonPhaseStart##phase = beginInstrumentedPhase()
+#define COMMON_INSTRUMENT_END(phase)			endInstrumentedPhase((phase), commonPhaseStart##phase)
+#define COMMON_INSTRUMENT_COUNT(counter, amount)	addInstrumentationCount((counter), (amount))
+#else
+#define COMMON_INSTRUMENT_BEGIN(phase)			((void)0)
+#define COMMON_INSTRUMENT_END(phase)			((void)0)
+#define COMMON_INSTRUMENT_COUNT(counter, amount)	((void)0)
+#endif /* COMMON_ENABLE_INSTRUMENTATION */
+
 /**
  *	@brief	fatal print and exit.
  *
@@ -106,7 +215,7 @@ void	fatal(const char *fmt, ...)
 /**
  *	@brief	Read single-precision floating-point data from a CSV file. Data entries are either numbers or Ux-values.
  *
- *	@param	inputFilePath		path to CSV file to read from
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
  *	@param	expectedHeaders		array of headers that should be in the CSV data
  *	@param	inputDistributions	array of input distributions to be obtained from the read CSV data
  *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
@@ -122,7 +231,7 @@ readInputFloatDistributionsFromCSV(
 /**
  *	@brief	Read double-precision floating-point data from a CSV file. Data entries are either numbers or Ux-values.
  *
- *	@param	inputFilePath		path to CSV file to read from
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
  *	@param	expectedHeaders		array of headers that should be in the CSV data
  *	@param	inputDistributions	array of input distributions to be obtained from the read CSV data
  *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
@@ -135,6 +244,457 @@ readInputDoubleDistributionsFromCSV(
 	double *		inputDistributions,
 	size_t			numberOfDistributions);
 
+/**
+ *	@brief	Read single-precision floating-point data from selected columns of a CSV file. Data entries are either numbers or Ux-values.
+ *
+ *	@details Each of `expectedHeaders` is matched by name against the CSV header, so
+ *	the CSV data may have further columns and the columns may be in any order. The
+ *	fields of other columns are skipped without being converted or stored. If a header
+ *	appears more than once, the first column with that header is used.
+ *
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
+ *	@param	expectedHeaders		array of headers of the columns to read
+ *	@param	inputDistributions	array of input distributions to be obtained from the read CSV data
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+readInputFloatDistributionsFromCSVColumns(
+	const char *		inputFilePath,
+	const char * const *	expectedHeaders,
+	float *			inputDistributions,
+	size_t			numberOfDistributions);
+
+/**
+ *	@brief	Read double-precision floating-point data from selected columns of a CSV file. Data entries are either numbers or Ux-values.
+ *
+ *	@details See `readInputFloatDistributionsFromCSVColumns()`.
+ *
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
+ *	@param	expectedHeaders		array of headers of the columns to read
+ *	@param	inputDistributions	array of input distributions to be obtained from the read CSV data
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+readInputDoubleDistributionsFromCSVColumns(
+	const char *		inputFilePath,
+	const char * const *	expectedHeaders,
+	double *		inputDistributions,
+	size_t			numberOfDistributions);
+
+/**
+ *	@brief	Read single-precision floating-point data from each of several CSV files with the same header.
+ *
+ *	@details The files are read concurrently, on up to the number of threads set with
+ *	`setCSVInputParsingThreadCount()`, and any threads left over parse the rows of
+ *	large files in parallel. The distributions of file `f` go to entries
+ *	`f * numberOfDistributions` to `(f + 1) * numberOfDistributions - 1` of
+ *	`inputDistributions`. A file that cannot be read is reported on `stderr` and its
+ *	entries are left unchanged, but the other files are still read.
+ *
+ *	@param	inputFilePaths		array of paths to CSV (or binary columns) files to read from
+ *	@param	numberOfInputFiles	size of `inputFilePaths`
+ *	@param	expectedHeaders		array of headers that should be in the CSV data of every file
+ *	@param	inputDistributions	array of `numberOfInputFiles * numberOfDistributions` input distributions to be obtained from the files
+ *	@param	numberOfDistributions	size of `expectedHeaders`
+ *	@param	fileReturnCodes		array of `numberOfInputFiles` results, one per file, or `NULL`
+ *	@return				`kCommonConstantReturnTypeError` if any file could not be read, `kCommonConstantReturnTypeSuccess` otherwise
+ */
+CommonConstantReturnType
+readInputFloatDistributionsFromCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes);
+
+/**
+ *	@brief	Read double-precision floating-point data from each of several CSV files with the same header.
+ *
+ *	@details See `readInputFloatDistributionsFromCSVFiles()`.
+ *
+ *	@param	inputFilePaths		array of paths to CSV (or binary columns) files to read from
+ *	@param	numberOfInputFiles	size of `inputFilePaths`
+ *	@param	expectedHeaders		array of headers that should be in the CSV data of every file
+ *	@param	inputDistributions	array of `numberOfInputFiles * numberOfDistributions` input distributions to be obtained from the files
+ *	@param	numberOfDistributions	size of `expectedHeaders`
+ *	@param	fileReturnCodes		array of `numberOfInputFiles` results, one per file, or `NULL`
+ *	@return				`kCommonConstantReturnTypeError` if any file could not be read, `kCommonConstantReturnTypeSuccess` otherwise
+ */
+CommonConstantReturnType
+readInputDoubleDistributionsFromCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes);
+
+/**
+ *	@brief	Read single-precision floating-point data from the samples of several CSV files together.
+ *
+ *	@details Reads the files like `readInputFloatDistributionsFromCSVFiles()`. Then,
+ *	for each column, the samples of all files that could be read are given, in file
+ *	order, to a single `UxHwFloatDistFromSamples()`. The files must be CSV and must not
+ *	hold Ux-values.
+ *
+ *	@param	inputFilePaths		array of paths to CSV files to read from
+ *	@param	numberOfInputFiles	size of `inputFilePaths`
+ *	@param	expectedHeaders		array of headers that should be in the CSV data of every file
+ *	@param	inputDistributions	array of input distributions to be obtained from the samples of all files
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@param	fileReturnCodes		array of `numberOfInputFiles` results, one per file, or `NULL`
+ *	@return				`kCommonConstantReturnTypeError` if any file could not be read, `kCommonConstantReturnTypeSuccess` otherwise
+ */
+CommonConstantReturnType
+readInputFloatDistributionsFromMergedCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	float *				inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes);
+
+/**
+ *	@brief	Read double-precision floating-point data from the samples of several CSV files together.
+ *
+ *	@details See `readInputFloatDistributionsFromMergedCSVFiles()`.
+ *
+ *	@param	inputFilePaths		array of paths to CSV files to read from
+ *	@param	numberOfInputFiles	size of `inputFilePaths`
+ *	@param	expectedHeaders		array of headers that should be in the CSV data of every file
+ *	@param	inputDistributions	array of input distributions to be obtained from the samples of all files
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@param	fileReturnCodes		array of `numberOfInputFiles` results, one per file, or `NULL`
+ *	@return				`kCommonConstantReturnTypeError` if any file could not be read, `kCommonConstantReturnTypeSuccess` otherwise
+ */
+CommonConstantReturnType
+readInputDoubleDistributionsFromMergedCSVFiles(
+	const char * const *		inputFilePaths,
+	size_t				numberOfInputFiles,
+	const char * const *		expectedHeaders,
+	double *			inputDistributions,
+	size_t				numberOfDistributions,
+	CommonConstantReturnType *	fileReturnCodes);
+
+typedef struct CSVInputReader CSVInputReader;
+
+/**
+ *	@brief	Prepare to read the same kind of CSV input repeatedly.
+ *
+ *	@details Each `readCSVInputReaderDistributions()` reads like
+ *	`readInputFloatDistributionsFromCSV()` (or its double-precision or `Columns`
+ *	variant, as set by `type` and `isProjection`), but keeps what it can for the next
+ *	read: a header row identical to the last accepted one is not checked again, and
+ *	the scratch memory of a read, including its column and sample storage, is reused
+ *	by the following reads instead of being allocated again. This suits parameter sweeps that read the same
+ *	file many times, or many files with the same header.
+ *
+ *	@param	expectedHeaders		array of headers that should be in the CSV data, which must outlive the reader
+ *	@param	isProjection		`true` to read only the columns named in `expectedHeaders`, wherever they are in the CSV data, `false` if the CSV data has exactly those columns in order
+ *	@param	type			whether to obtain single-precision or double-precision distributions
+ *	@param	numberOfDistributions	size of `expectedHeaders`
+ *	@return				The reader. Aborts on failure.
+ */
+CSVInputReader *
+openCSVInputReader(
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions);
+
+/**
+ *	@brief	Read distributions from a CSV file (or binary columns file) with a reader.
+ *
+ *	@param	reader			reader from `openCSVInputReader()`
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
+ *	@param	inputDistributions	array of `numberOfDistributions` floats or doubles, as given to `openCSVInputReader()`, to be obtained from the read CSV data
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+readCSVInputReaderDistributions(
+	CSVInputReader *	reader,
+	const char *		inputFilePath,
+	void *			inputDistributions);
+
+/**
+ *	@brief	Free a reader and everything it kept between reads.
+ *
+ *	@param	reader	reader from `openCSVInputReader()`, or `NULL`
+ */
+void
+closeCSVInputReader(CSVInputReader *  reader);
+
+typedef struct LazyInputDistributions LazyInputDistributions;
+
+/**
+ *	@brief	Parse a CSV file now but obtain each input distribution only when it is first used.
+ *
+ *	@details The samples of every column are parsed and kept, and each distribution is
+ *	obtained with `UxHwFloatDistFromSamples()` (or `UxHwDoubleDistFromSamples()`) on its
+ *	first `getLazyInputFloatDistribution()` (or `getLazyInputDoubleDistribution()`) and
+ *	remembered after that, so that columns that are never used never pay for it.
+ *	Binary columns files and inputs found in the input cache (see
+ *	`setCSVInputCache()`) have all their distributions obtained up front. The result
+ *	is not safe to use from several threads at once.
+ *
+ *	@param	inputFilePath		path to CSV file to read from, or "stdin" to stream it from standard input
+ *	@param	expectedHeaders		array of headers that should be in the CSV data
+ *	@param	isProjection		`true` to read only the columns named in `expectedHeaders`, wherever they are in the CSV data, `false` if the CSV data has exactly those columns in order
+ *	@param	type			whether to obtain single-precision or double-precision distributions
+ *	@param	numberOfDistributions	size of `expectedHeaders`
+ *	@return				The parsed input, to be freed with `freeLazyInputDistributions()`, or `NULL` on error
+ */
+LazyInputDistributions *
+readLazyInputDistributionsFromCSV(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions);
+
+/**
+ *	@brief	Number of distributions in a lazily read input.
+ *
+ *	@param	lazy	input from `readLazyInputDistributionsFromCSV()`
+ *	@return		`numberOfDistributions` as given to `readLazyInputDistributionsFromCSV()`
+ */
+size_t
+getLazyInputDistributionsCount(const LazyInputDistributions *  lazy);
+
+/**
+ *	@brief	Get a single-precision input distribution, obtaining it from its samples on first use.
+ *
+ *	@param	lazy	input from `readLazyInputDistributionsFromCSV()` with `kFloatingPointVariableTypeFloat`
+ *	@param	index	index of the distribution, in the order of `expectedHeaders`. Aborts if out of range.
+ *	@return		The distribution
+ */
+float
+getLazyInputFloatDistribution(LazyInputDistributions *  lazy, size_t  index);
+
+/**
+ *	@brief	Get a double-precision input distribution, obtaining it from its samples on first use.
+ *
+ *	@param	lazy	input from `readLazyInputDistributionsFromCSV()` with `kFloatingPointVariableTypeDouble`
+ *	@param	index	index of the distribution, in the order of `expectedHeaders`. Aborts if out of range.
+ *	@return		The distribution
+ */
+double
+getLazyInputDoubleDistribution(LazyInputDistributions *  lazy, size_t  index);
+
+/**
+ *	@brief	Free a lazily read input together with its samples.
+ *
+ *	@param	lazy	input from `readLazyInputDistributionsFromCSV()`, or `NULL`
+ */
+void
+freeLazyInputDistributions(LazyInputDistributions *  lazy);
+
+typedef struct CSVInputTail CSVInputTail;
+
+/**
+ *	@brief	Start following a CSV file that keeps having rows appended to it.
+ *
+ *	@details Each `updateCSVInputTail()` parses only the rows appended since the one
+ *	before, adds their samples to those of the earlier rows, and gets the input
+ *	distributions from all of them. The header is checked once, by the first update
+ *	that sees it. The file must only grow.
+ *
+ *	@param	inputFilePath		path to CSV file to follow, or "stdin"
+ *	@param	expectedHeaders		array of headers that should be in the CSV data, which must outlive the tail
+ *	@param	isProjection		`true` to read only the columns named in `expectedHeaders`, wherever they are in the CSV data, `false` if the CSV data has exactly those columns in order
+ *	@param	type			whether to obtain single-precision or double-precision distributions
+ *	@param	numberOfDistributions	size of `expectedHeaders`
+ *	@return				The tail, to be closed with `closeCSVInputTail()`, or `NULL` if the file cannot be opened
+ */
+CSVInputTail *
+openCSVInputTail(
+	const char *			inputFilePath,
+	const char * const *		expectedHeaders,
+	bool				isProjection,
+	FloatingPointVariableType	type,
+	size_t				numberOfDistributions);
+
+/**
+ *	@brief	Parse the rows appended to a followed CSV file and update its distributions.
+ *
+ *	@details Only complete rows, ending in a newline, are parsed; a row still being
+ *	written is picked up by a later update. Parsing costs time in proportion to the new
+ *	rows only, while getting the distributions uses the samples of every row so far.
+ *	`inputDistributions` is only written when there are new rows. After an error, every
+ *	later update fails as well.
+ *
+ *	@param	tail			tail from `openCSVInputTail()`
+ *	@param	inputDistributions	array of `numberOfDistributions` floats or doubles, as given to `openCSVInputTail()`, to be obtained from all rows read so far
+ *	@param	numberOfNewRows		set to the number of rows parsed by this update, if not `NULL`
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+updateCSVInputTail(
+	CSVInputTail *	tail,
+	void *		inputDistributions,
+	size_t *	numberOfNewRows);
+
+/**
+ *	@brief	Byte offset in a followed CSV file up to which its rows have been parsed.
+ *
+ *	@param	tail	tail from `openCSVInputTail()`
+ *	@return		Offset of the first byte not yet parsed
+ */
+uint64_t
+getCSVInputTailOffset(const CSVInputTail *  tail);
+
+/**
+ *	@brief	Stop following a CSV file and free its samples.
+ *
+ *	@param	tail	tail from `openCSVInputTail()`, or `NULL`
+ */
+void
+closeCSVInputTail(CSVInputTail *  tail);
+
+/**
+ *	@brief	Detect the format of an input file from its leading magic bytes.
+ *
+ *	@details Files that do not start with the binary columns magic, files that cannot be
+ *	opened, and "stdin" are all reported as CSV. `readInputFloatDistributionsFromCSV()`
+ *	and `readInputDoubleDistributionsFromCSV()` use this to read binary columns files
+ *	transparently.
+ *
+ *	@param	inputFilePath	path to the input file
+ *	@return			format of the input file
+ */
+InputFileFormat
+detectInputFileFormat(const char *  inputFilePath);
+
+/**
+ *	@brief	Read single-precision floating-point data from a binary columns file (see
+ *		`convertCSVToBinaryColumns()`).
+ *
+ *	@details The file is mapped into memory and, when it holds single-precision
+ *	samples, the sample arrays are passed to `UxHwFloatDistFromSamples()` in place.
+ *
+ *	@param	inputFilePath		path to binary columns file to read from
+ *	@param	expectedHeaders		array of column names that should be in the file, in order
+ *	@param	inputDistributions	array of input distributions to be obtained from the file
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+readInputFloatDistributionsFromBinaryColumns(
+	const char *		inputFilePath,
+	const char * const *	expectedHeaders,
+	float *			inputDistributions,
+	size_t			numberOfDistributions);
+
+/**
+ *	@brief	Read double-precision floating-point data from a binary columns file (see
+ *		`convertCSVToBinaryColumns()`).
+ *
+ *	@details The file is mapped into memory and, when it holds double-precision
+ *	samples, the sample arrays are passed to `UxHwDoubleDistFromSamples()` in place.
+ *
+ *	@param	inputFilePath		path to binary columns file to read from
+ *	@param	expectedHeaders		array of column names that should be in the file, in order
+ *	@param	inputDistributions	array of input distributions to be obtained from the file
+ *	@param	numberOfDistributions	size of `inputDistributions` _and_ `expectedHeaders` arrays
+ *	@return				`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+readInputDoubleDistributionsFromBinaryColumns(
+	const char *		inputFilePath,
+	const char * const *	expectedHeaders,
+	double *		inputDistributions,
+	size_t			numberOfDistributions);
+
+/**
+ *	@brief	Convert an input CSV file to a binary columns file.
+ *
+ *	@details The binary columns file holds the column names from the CSV header and,
+ *	for each column, either its samples as one contiguous little-endian array aligned
+ *	to 64 bytes, or the raw text of its Ux-value. Column names have leading and
+ *	trailing whitespace removed.
+ *
+ *	@param	csvFilePath	path to CSV file to convert
+ *	@param	binaryFilePath	path to binary columns file to write
+ *	@param	sampleType	whether to store single-precision or double-precision samples
+ *	@return			`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+convertCSVToBinaryColumns(
+	const char *			csvFilePath,
+	const char *			binaryFilePath,
+	FloatingPointVariableType	sampleType);
+
+/**
+ *	@brief	Set the number of threads that `readInputFloatDistributionsFromCSV()` and
+ *		`readInputDoubleDistributionsFromCSV()` use to parse data rows.
+ *
+ *	@details The rows are split into chunks on row boundaries, at least
+ *	`kCommonConstantMinCharsPerCSVParsingThread` bytes each, and every chunk is parsed
+ *	on its own thread. Defaults to 1, parsing on the calling thread. Has no effect on
+ *	platforms without POSIX threads.
+ *
+ *	@param	numberOfThreads	number of parsing threads, or 0 for one per online processor
+ */
+void
+setCSVInputParsingThreadCount(size_t numberOfThreads);
+
+/**
+ *	@brief	Enable or disable the on-disk cache of parsed CSV input.
+ *
+ *	@details While enabled, `readInputFloatDistributionsFromCSV()` and
+ *	`readInputDoubleDistributionsFromCSV()` store the parsed samples of each regular
+ *	input file in `cacheDirectoryPath`, keyed by the file's path and the expected
+ *	headers. Later reads of the same unchanged file, with the same headers, map the
+ *	cache file instead of parsing the CSV again. A cache file is ignored (and
+ *	replaced) once the size, modification time or inode of its CSV file change.
+ *	Disabled by default; `parseArgs()` enables it for `--csv-cache`. Has no effect on
+ *	platforms without POSIX file APIs.
+ *
+ *	@param	cacheDirectoryPath	directory for cache files, created if missing, or `NULL` to disable the cache
+ *	@param	isVerbose		whether to report cache hits and misses on `stderr`
+ */
+void
+setCSVInputCache(const char *  cacheDirectoryPath, bool  isVerbose);
+
+/**
+ *	@brief	Read CSV input in bounded memory by keeping only a random sample of each column.
+ *
+ *	@details While `sketchSize` is non-zero, `readInputFloatDistributionsFromCSV()` and
+ *	the other CSV readers (except the merging and tail readers, and
+ *	`convertCSVToBinaryColumns()`) stream their input a block at a time and keep, for
+ *	each column, a uniform random sample (reservoir) of at most `sketchSize` of its
+ *	samples, from which the distribution is then obtained. Memory use then no longer
+ *	grows with the size of the input. The kept samples depend only on the input and
+ *	`seed`. With `isVerbose`, the number of samples kept of each column and a 95%
+ *	bound on the error of its distribution function are reported on `stderr`.
+ *	Sketched reads bypass the input cache. Disabled by default; `parseArgs()` sets it
+ *	for `--csv-sketch-size` and `--csv-sketch-seed`.
+ *
+ *	@param	sketchSize	most samples to keep per column, or 0 to keep them all
+ *	@param	seed		seed of the random choice of the kept samples
+ *	@param	isVerbose	whether to report the approximation of each column on `stderr`
+ */
+void
+setCSVInputSketch(size_t  sketchSize, uint64_t  seed, bool  isVerbose);
+
+/**
+ *	@brief	Check the shape of CSV input before parsing it.
+ *
+ *	@details While enabled, the CSV readers first count the rows of a memory-mapped
+ *	input file and the fields of every row in one pass over its commas and newlines,
+ *	without converting any number. A row with too many or too few fields is then
+ *	reported before any row is parsed, and the count sizes the sample storage. Inputs
+ *	that are streamed, such as "stdin", are still checked as they are parsed. Disabled
+ *	by default; `parseArgs()` enables it for `--csv-prescan`.
+ *
+ *	@param	isEnabled	whether to pre-scan the input
+ */
+void
+setCSVInputPrescan(bool  isEnabled);
+
 /**
  *	@brief	Write Ux-valued data of single-precision floating-point variables to a CSV file.
  *
@@ -180,6 +740,39 @@ printJSONVariables(
 	size_t		count,
 	const char *	description);
 
+/**
+ *	@brief	Set how `printJSONVariables()` writes the values of particle variables.
+ *
+ *	@details With `kJSONParticleEncodingText`, the default, every particle value is a
+ *	string in the "values" array and "stdValues" holds a zero for each. With
+ *	`kJSONParticleEncodingBase64`, a particle variable instead has a "valuesEncoding"
+ *	of "base64-float32le" or "base64-float64le" and a "values" string holding the
+ *	base64 of the little-endian IEEE 754 bytes of all its values, and no "stdValues".
+ *	This is about a quarter of the text and needs no number parsing to read. Other
+ *	variables are written as text either way. `parseArgs()` calls this for
+ *	`--particle-encoding`.
+ *
+ *	@param	encoding	Encoding of particle values
+ */
+void
+setJSONParticleEncoding(JSONParticleEncoding  encoding);
+
+/**
+ *	@brief	Wait until all output files have been written and closed.
+ *
+ *	@details `writeOutputFloatDistributionsToCSV()`, `writeOutputDoubleDistributionsToCSV()`,
+ *	`saveMonteCarloFloatDataToDataDotOutFile()` and `saveMonteCarloDoubleDataToDataDotOutFile()`
+ *	return once their output is formatted in memory. Where POSIX threads exist, a
+ *	background thread then writes, syncs and closes the files. Call this before
+ *	reading the files back or exiting, to find out whether writing them failed. It
+ *	also runs at `exit()`. Output to the standard output is always written
+ *	before those functions return.
+ *
+ *	@return	`kCommonConstantReturnTypeError` if any output file could not be written since the last call, `kCommonConstantReturnTypeSuccess` otherwise
+ */
+CommonConstantReturnType
+flushOutputSinks(void);
+
 /**
  *	@brief	Parse an integer at the start of `str`, trailing characters are ignored.
  *
@@ -192,6 +785,20 @@ parseIntChecked(
 	const char *	str,
 	int *		out);
 
+/**
+ *	@brief	Parse an unsigned 64-bit integer at the start of `str`, trailing characters are ignored.
+ *
+ *	@details Unlike `strtoull()`, a negative value is an error rather than wrapping around.
+ *
+ *	@param	str	String to parse
+ *	@param	out	Will be set to parsed value
+ *	@return 	`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+parseUint64Checked(
+	const char *	str,
+	uint64_t *	out);
+
 /**
  *	@brief	Parse a single-precision floating-point value at the start of `str`, trailing characters are ignored.
  *
@@ -216,29 +823,76 @@ parseDoubleChecked(
 	const char *	str,
 	double *	out);
 
-typedef struct
-{
-	char	outputFilePath[kCommonConstantMaxCharsPerFilepath];
-	char	inputFilePath[kCommonConstantMaxCharsPerFilepath];
-	bool	isWriteToFileEnabled;
-	bool	isTimingEnabled;
-	size_t	numberOfMonteCarloIterations;
-	size_t	outputSelect;
-	bool	isOutputSelected;
-	bool	isVerbose;
-	bool	isInputFromFileEnabled;
-	bool	isOutputJSONMode;
-	bool	isHelpEnabled;
-	bool	isBenchmarkingMode;
-	bool	isMonteCarloMode;
-	bool	isSingleShotExecution;
-} CommonCommandLineArguments;
+/**
+ *	@brief	Parse a single-precision floating-point value at the start of `str` like
+ *		`parseFloatChecked()`, but faster and independent of the locale.
+ *
+ *	@details Plain decimal numbers are converted with correct rounding by the
+ *	Eisel-Lemire algorithm. Everything else (hexadecimal, infinity, NaN, Ux-values,
+ *	subnormal or out-of-range results) falls back to `parseFloatChecked()`, so the
+ *	same strings are accepted and rejected.
+ *
+ *	@param	str	String to parse
+ *	@param	out	Will be set to parsed value
+ *	@return 	`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+parseFloatFast(
+	const char *	str,
+	float *		out);
 
-typedef struct
-{
-	/**
-	 *	@brief The command-line flag (without leading `-` or `--`) for this option.
-	 */
+/**
+ *	@brief	Parse a double-precision floating-point value at the start of `str` like
+ *		`parseDoubleChecked()`, but faster and independent of the locale.
+ *
+ *	@details Plain decimal numbers are converted with correct rounding by the
+ *	Eisel-Lemire algorithm. Everything else (hexadecimal, infinity, NaN, Ux-values,
+ *	subnormal or out-of-range results) falls back to `parseDoubleChecked()`, so the
+ *	same strings are accepted and rejected.
+ *
+ *	@param	str	String to parse
+ *	@param	out	Will be set to parsed value
+ *	@return 	`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+parseDoubleFast(
+	const char *	str,
+	double *	out);
+
+typedef struct
+{
+	char			outputFilePath[kCommonConstantMaxCharsPerFilepath];
+	char			inputFilePath[kCommonConstantMaxCharsPerFilepath];
+	const char **		inputFilePaths;
+	size_t			numberOfInputFiles;
+	char			inputCacheDirectoryPath[kCommonConstantMaxCharsPerFilepath];
+	bool			isInputCacheEnabled;
+	char			monteCarloOutputFilePath[kCommonConstantMaxCharsPerFilepath];
+	MonteCarloOutputFormat	monteCarloOutputFormat;
+	JSONParticleEncoding	jsonParticleEncoding;
+	size_t			numberOfThreads;
+	size_t			sketchSize;
+	uint64_t		sketchSeed;
+	bool			isInputPrescanEnabled;
+	bool			isWriteToFileEnabled;
+	bool			isTimingEnabled;
+	size_t			numberOfMonteCarloIterations;
+	size_t			outputSelect;
+	bool			isOutputSelected;
+	bool			isVerbose;
+	bool			isInputFromFileEnabled;
+	bool			isOutputJSONMode;
+	bool			isHelpEnabled;
+	bool			isBenchmarkingMode;
+	bool			isMonteCarloMode;
+	bool			isSingleShotExecution;
+} CommonCommandLineArguments;
+
+typedef struct
+{
+	/**
+	 *	@brief The command-line flag (without leading `-` or `--`) for this option.
+	 */
 	const char *	opt;
 
 	/**
@@ -276,6 +930,25 @@ typedef struct
  *	@brief	Parse command-line arguments into `args`.
  *
  * 	@details Grouped short options are not supported. (Use `-W -j` rather than `-Wj`.)
+ *	The `-i` path is copied to `inputFilePath` as given, without touching the file
+ *	system; see `expandInputFilePaths()` for directories and glob patterns. Parsing
+ *	allocates no paths, and leaves `inputFilePaths` `NULL`: call
+ *	`freeCommandLineArguments()` before parsing again into `arguments` that have since
+ *	been expanded.
+ *
+ *	A demo option may not share a name with one of the original common options (`-i`
+ *	to `-b` in `printCommonUsage()`). It takes precedence over any later common option
+ *	of the same name, such as `--worker-threads`. Demo options and the original common
+ *	options may be abbreviated to any unique prefix among them, while the later common
+ *	options must be given in full: `-w` may abbreviate a demo option `--window`, and
+ *	`-wo` is an error rather than `--worker-threads`.
+ *
+ *	The library settings behind the other options are only changed by the options
+ *	given: a path or format set with `setMonteCarloOutput()`, a sketch size or seed set
+ *	with `setCSVInputSketch()`, a pre-scan enabled with `setCSVInputPrescan()`, or an
+ *	encoding set with `setJSONParticleEncoding()`, is kept, and reported in
+ *	`arguments`, unless `--data-out`, `--data-out-format`, `--csv-sketch-size`,
+ *	`--csv-sketch-seed`, `--csv-prescan` or `--particle-encoding` overrides it.
  *
  *	@param	argc			As provided to `main()`
  *	@param	argv			As provided to `main()`
@@ -290,18 +963,350 @@ parseArgs(
 	CommonCommandLineArguments *	arguments,
 	DemoOption *			demoSpecificOptions);
 
+typedef struct DemoOptionTable DemoOptionTable;
+
+/**
+ *	@brief	Create an empty option table for `parseArgsWithOptionTable()`. Aborts on allocation failure.
+ *
+ *	@return			The table
+ */
+DemoOptionTable *
+createDemoOptionTable(void);
+
+/**
+ *	@brief	Parse command-line arguments into `args`, like `parseArgs()`, reusing `optionTable`.
+ *
+ *	@details The first parse builds the long options of `demoSpecificOptions` and of the
+ *	common options into `optionTable` and perfect-hashes them by name, which also checks
+ *	them for duplicate names. Later parses with the same `demoSpecificOptions` (the same
+ *	array, with the same names) reuse it after a check of the name pointers; other
+ *	options rebuild it. `parseArgs()` keeps a table of its own in the same way. The
+ *	option names must outlive the table. The pointers in `argv` are not changed: getopt
+ *	parses a copy in the table, with abbreviated options replaced by the full option
+ *	names. Arguments found in those replacements live until the next parse with the
+ *	table.
+ *
+ *	@param	argc			As provided to `main()`
+ *	@param	argv			As provided to `main()`
+ *	@param	args			Parsed command-line arguments are stored here
+ *	@param	demoSpecificOptions	Extra command-line arguments to parse
+ *	@param	optionTable		Table from `createDemoOptionTable()`
+ *	@return 			`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+parseArgsWithOptionTable(
+	int				argc,
+	char *  const			argv[],
+	CommonCommandLineArguments *	arguments,
+	DemoOption *			demoSpecificOptions,
+	DemoOptionTable *		optionTable);
+
+/**
+ *	@brief	Free an option table.
+ *
+ *	@param	optionTable	Table from `createDemoOptionTable()`, or `NULL`
+ */
+void
+destroyDemoOptionTable(DemoOptionTable *  optionTable);
+
+/**
+ *	@brief	Expand the `-i` path of `arguments` into `inputFilePaths` and `numberOfInputFiles`.
+ *
+ *	@details The path may name a directory, for all of its ".csv" files, or be a glob
+ *	pattern (where the platform has `glob()`); any other path is the only file. The
+ *	paths are in sorted order, for `readInputFloatDistributionsFromCSVFiles()` and the
+ *	like. Nothing is expanded again once `inputFilePaths` is set. Release the paths with
+ *	`freeCommandLineArguments()`.
+ *
+ *	@param	arguments	Arguments from `parseArgs()`, with `isInputFromFileEnabled`
+ *	@return 		`kCommonConstantReturnTypeError` on error, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+expandInputFilePaths(CommonCommandLineArguments *  arguments);
+
+/**
+ *	@brief	Free what `expandInputFilePaths()` allocated in `arguments`.
+ *
+ *	@details `inputFilePaths` is left `NULL` and `numberOfInputFiles` zero, so the
+ *	arguments can be expanded or parsed into again.
+ *
+ *	@param	arguments	Arguments from `parseArgs()`
+ */
+void
+freeCommandLineArguments(CommonCommandLineArguments *  arguments);
+
 /**
  *	@brief	Print the common part of the usage to stdout.
  */
 void
 printCommonUsage(void);
 
+/**
+ *	@brief	Bump allocator: allocations are carved in order from large blocks and all
+ *		released together.
+ */
+typedef struct Arena Arena;
+
+typedef struct
+{
+	const void *	block;
+	size_t		used;
+} ArenaMark;
+
+/**
+ *	@brief	Create an empty arena. Aborts on allocation failure.
+ *
+ *	@param	blockSize	Size of the blocks the arena allocates from, or 0 for 64 KiB.
+ *				Larger allocations get a block of their own.
+ *	@return			The arena
+ */
+Arena *
+createArena(size_t blockSize);
+
+/**
+ *	@brief	Allocate from `arena`, aligned to 16 bytes, and abort on allocation failure.
+ *
+ *	@param	arena	Arena to allocate from
+ *	@param	size	Number of bytes to allocate
+ *	@param	file	File name to include in error message
+ *	@param	line	Line number to include in error message
+ *	@return		Pointer into the arena, valid until the arena is reset past it
+ */
+void *
+checkedArenaMalloc(
+	Arena *		arena,
+	size_t		size,
+	const char *	file,
+	int		line);
+
+/**
+ *	@brief	Allocate from `arena` with the given alignment and abort on allocation failure.
+ *
+ *	@param	arena		Arena to allocate from
+ *	@param	alignment	A power of two up to `kCommonConstantSampleColumnsAlignment`
+ *	@param	size		Number of bytes to allocate
+ *	@param	file		File name to include in error message
+ *	@param	line		Line number to include in error message
+ *	@return			Pointer into the arena, valid until the arena is reset past it
+ */
+void *
+checkedArenaAlignedMalloc(
+	Arena *		arena,
+	size_t		alignment,
+	size_t		size,
+	const char *	file,
+	int		line);
+
+/**
+ *	@brief	Allocate zeroed memory for `num` elements of `size` bytes from `arena` and
+ *		abort on allocation failure.
+ *
+ *	@param	arena	Arena to allocate from
+ *	@param	num	Number of elements
+ *	@param	size	Size of each element
+ *	@param	file	File name to include in error message
+ *	@param	line	Line number to include in error message
+ *	@return		Pointer into the arena, valid until the arena is reset past it
+ */
+void *
+checkedArenaCalloc(
+	Arena *		arena,
+	size_t		num,
+	size_t		size,
+	const char *	file,
+	int		line);
+
+/**
+ *	@brief	Current position of `arena`, to release everything allocated after it with
+ *		`resetArenaToMark()`.
+ *
+ *	@param	arena	The arena
+ *	@return		The position
+ */
+ArenaMark
+getArenaMark(const Arena *  arena);
+
+/**
+ *	@brief	Release everything allocated from `arena` since `mark`. The memory is kept
+ *		for later allocations.
+ *
+ *	@param	arena	The arena
+ *	@param	mark	Position returned by `getArenaMark()`
+ */
+void
+resetArenaToMark(
+	Arena *		arena,
+	ArenaMark	mark);
+
+/**
+ *	@brief	Release everything allocated from `arena`. The memory is kept for later
+ *		allocations.
+ *
+ *	@param	arena	The arena
+ */
+void
+resetArena(Arena *  arena);
+
+/**
+ *	@brief	Free `arena` and all of its memory.
+ *
+ *	@param	arena	The arena, or `NULL`
+ */
+void
+destroyArena(Arena *  arena);
+
+/**
+ *	@brief	Set the arena that the library's input routines on the calling thread take
+ *		their scratch memory from.
+ *
+ *	@details The CSV and binary columns readers allocate their sample columns and
+ *	other per-call memory from this arena and release it before returning, so a
+ *	program that reads inputs repeatedly reuses the same memory. By default each
+ *	thread uses an arena of the library's own. `arena` must stay valid while it is set.
+ *
+ *	@param	arena	The arena, or `NULL` for the library's own
+ */
+void
+setScratchArena(Arena *  arena);
+
+/**
+ *	@brief	Samples of several variables, stored column-major in a single allocation.
+ *
+ *	@details Each column has room for `capacity` samples and starts at a multiple of
+ *	`kCommonConstantSampleColumnsAlignment` bytes. Column `i` holds `sampleCounts[i]`
+ *	samples and can be passed as is to `UxHwFloatDistFromSamples()` or
+ *	`UxHwDoubleDistFromSamples()`. `arena` is the arena the columns are allocated
+ *	from, or `NULL` if they are on the heap.
+ */
+typedef struct
+{
+	FloatingPointVariableType	type;
+	size_t				sampleSize;
+	size_t				numberOfColumns;
+	size_t				capacity;
+	size_t *			sampleCounts;
+	void *				samples;
+	Arena *				arena;
+} SampleColumns;
+
+/**
+ *	@brief	Allocate empty sample columns. Aborts on allocation failure.
+ *
+ *	@param	columns			Sample columns to initialize
+ *	@param	type			Whether samples are single-precision or double-precision floating-point values
+ *	@param	numberOfColumns		Number of columns, at least one
+ *	@param	initialCapacity		Number of samples per column to allocate room for, rounded up to fill the alignment
+ */
+void
+initSampleColumns(
+	SampleColumns *			columns,
+	FloatingPointVariableType	type,
+	size_t				numberOfColumns,
+	size_t				initialCapacity);
+
+/**
+ *	@brief	Grow sample columns to hold at least `minimumCapacity` samples per column, keeping their samples.
+ *
+ *	@details The capacity at least doubles, so that appending samples one at a time
+ *	takes amortized constant time. Column pointers from before the call are invalid
+ *	afterwards if the columns grew.
+ *
+ *	@param	columns			Sample columns to grow
+ *	@param	minimumCapacity		Number of samples per column to make room for
+ */
+void
+reserveSampleColumns(
+	SampleColumns *	columns,
+	size_t		minimumCapacity);
+
+/**
+ *	@brief	Get the samples of a column of single-precision sample columns.
+ *
+ *	@param	columns		Sample columns of type `kFloatingPointVariableTypeFloat`
+ *	@param	column		Index of the column
+ *	@return			Pointer to the `capacity` samples of the column
+ */
+float *
+getFloatSampleColumn(
+	const SampleColumns *	columns,
+	size_t			column);
+
+/**
+ *	@brief	Get the samples of a column of double-precision sample columns.
+ *
+ *	@param	columns		Sample columns of type `kFloatingPointVariableTypeDouble`
+ *	@param	column		Index of the column
+ *	@return			Pointer to the `capacity` samples of the column
+ */
+double *
+getDoubleSampleColumn(
+	const SampleColumns *	columns,
+	size_t			column);
+
+/**
+ *	@brief	Free sample columns.
+ *
+ *	@param	columns		Sample columns to free
+ */
+void
+freeSampleColumns(SampleColumns *  columns);
+
 typedef struct
 {
 	double	mean;
 	double	variance;
 } MeanAndVariance;
 
+/**
+ *	@brief	Population moments of a set of samples.
+ *
+ *	@details `kurtosis` is the excess kurtosis (zero for a Gaussian). `skewness` and
+ *	`kurtosis` are zero when all samples are equal, and all members are zero when
+ *	there are no samples.
+ */
+typedef struct
+{
+	size_t	count;
+	double	mean;
+	double	variance;
+	double	skewness;
+	double	kurtosis;
+	double	min;
+	double	max;
+} SampleMoments;
+
+/**
+ *	@brief	Calculate the mean, variance, skewness, kurtosis, minimum and maximum of
+ *		float data in one pass.
+ *
+ *	@details Accumulates in double, in blocks whose moments are taken about their own
+ *	mean and then merged pairwise, so that the result stays accurate for data with a
+ *	large mean or many samples.
+ *
+ *	@param	dataArray	data array for which to compute the moments
+ *	@param	dataArraySize	number of items in `dataArray`
+ *	@return			calculated moments
+ */
+SampleMoments
+calculateMomentsOfFloatSamples(
+	const float *	dataArray,
+	size_t		dataArraySize);
+
+/**
+ *	@brief	Calculate the mean, variance, skewness, kurtosis, minimum and maximum of
+ *		double data in one pass.
+ *
+ *	@details See `calculateMomentsOfFloatSamples()`.
+ *
+ *	@param	dataArray	data array for which to compute the moments
+ *	@param	dataArraySize	number of items in `dataArray`
+ *	@return			calculated moments
+ */
+SampleMoments
+calculateMomentsOfDoubleSamples(
+	const double *	dataArray,
+	size_t		dataArraySize);
+
 /**
  *	@brief	Caluculate mean and variance of float data.
  *
@@ -327,7 +1332,28 @@ calculateMeanAndVarianceOfDoubleSamples(
 	size_t		dataArraySize);
 
 /**
- *	@brief	Writes Monte Carlo samples to a file 'data.out'
+ *	@brief	Set where and in which format the Monte Carlo samples are written.
+ *
+ *	@details Applies to `saveMonteCarloFloatDataToDataDotOutFile()` and
+ *	`saveMonteCarloDoubleDataToDataDotOutFile()`. By default they write text to
+ *	'data.out'. `parseArgs()` calls this for `--data-out` and `--data-out-format`.
+ *
+ *	`kMonteCarloOutputFormatBinary` writes a 40-byte header (the magic
+ *	"\x89UxMCS\r\n", version, sample type, CPU time, number of samples and flags)
+ *	followed by the raw little-endian samples. `kMonteCarloOutputFormatLZ4` writes the
+ *	same file as an LZ4 frame of 1 MiB blocks, which `lz4 -d` decompresses back to the
+ *	binary file.
+ *
+ *	@param	outputFilePath	Path of the file to write, or `NULL` to keep the current one
+ *	@param	format		Format of the file
+ */
+void
+setMonteCarloOutput(
+	const char *		outputFilePath,
+	MonteCarloOutputFormat	format);
+
+/**
+ *	@brief	Writes Monte Carlo samples to a file 'data.out', or as set by `setMonteCarloOutput()`
  *
  *	@param	benchmarkingDataSamples		Array (length `numberOfMonteCarloIterations`) of float Monte Carlo samples
  *	@param	cpuTimeElapsedMicroSeconds	Execution time of kernel
@@ -341,7 +1367,7 @@ saveMonteCarloFloatDataToDataDotOutFile(
 	size_t		numberOfMonteCarloIterations);
 
 /**
- *	@brief	Writes Monte Carlo samples to a file 'data.out'
+ *	@brief	Writes Monte Carlo samples to a file 'data.out', or as set by `setMonteCarloOutput()`
  *
  *	@param	benchmarkingDataSamples		Array (length `numberOfMonteCarloIterations`) of double Monte Carlo samples
  *	@param	cpuTimeElapsedMicroSeconds	Execution time of kernel
@@ -354,6 +1380,270 @@ saveMonteCarloDoubleDataToDataDotOutFile(
 	uint64_t	cpuTimeElapsedMicroSeconds,
 	size_t		numberOfMonteCarloIterations);
 
+typedef struct MonteCarloSampleSink MonteCarloSampleSink;
+
+/**
+ *	@brief	Start collecting Monte Carlo samples one at a time.
+ *
+ *	@details Keeps the running mean and variance of the samples, so that a Monte
+ *	Carlo run does not need to hold all of its samples. If `isDumpEnabled`, the
+ *	samples are also written, in fixed-size blocks, to the file and in the format set
+ *	by `setMonteCarloOutput()`; the CPU time and number of samples in the file are
+ *	filled in by `closeMonteCarloSampleSink()`, so the file must be seekable.
+ *
+ *	@param	sampleType	Type of the samples to push
+ *	@param	isDumpEnabled	Whether to write the samples to the Monte Carlo samples file
+ *	@return			The sink. Aborts on failure.
+ */
+MonteCarloSampleSink *
+openMonteCarloSampleSink(
+	FloatingPointVariableType	sampleType,
+	bool				isDumpEnabled);
+
+/**
+ *	@brief	Add a sample to a sink opened for `kFloatingPointVariableTypeFloat`.
+ *
+ *	@param	sink	Sink to add to
+ *	@param	sample	The sample
+ */
+void
+pushMonteCarloFloatSample(
+	MonteCarloSampleSink *	sink,
+	float			sample);
+
+/**
+ *	@brief	Add a sample to a sink opened for `kFloatingPointVariableTypeDouble`.
+ *
+ *	@param	sink	Sink to add to
+ *	@param	sample	The sample
+ */
+void
+pushMonteCarloDoubleSample(
+	MonteCarloSampleSink *	sink,
+	double			sample);
+
+/**
+ *	@brief	Finish a Monte Carlo run, completing its samples file, and free `sink`.
+ *
+ *	@param	sink				Sink to close
+ *	@param	cpuTimeElapsedMicroSeconds	Execution time of kernel
+ *	@return					Mean and (population) variance of the pushed samples
+ */
+MeanAndVariance
+closeMonteCarloSampleSink(
+	MonteCarloSampleSink *	sink,
+	uint64_t		cpuTimeElapsedMicroSeconds);
+
+/**
+ *	@brief	State of a random number stream of a Monte Carlo iteration.
+ */
+typedef struct
+{
+	uint64_t	state[4];
+} MonteCarloRandom;
+
+/**
+ *	@brief	Next 64 random bits from `random` (xoshiro256**).
+ *
+ *	@param	random	Random number stream
+ *	@return		The random bits
+ */
+uint64_t
+nextMonteCarloRandom(MonteCarloRandom *  random);
+
+/**
+ *	@brief	Next random double from `random`, uniform in [0, 1).
+ *
+ *	@param	random	Random number stream
+ *	@return		The random double
+ */
+double
+nextMonteCarloUniform(MonteCarloRandom *  random);
+
+/**
+ *	@brief	Kernel of a Monte Carlo run: computes the sample of one iteration.
+ *
+ *	@param	threadContext	Context of the calling thread, see `runMonteCarloIterations()`
+ *	@param	iteration	Index of the iteration
+ *	@param	random		Random number stream of the iteration
+ *	@return			The sample
+ */
+typedef double (*MonteCarloKernel)(void *  threadContext, size_t  iteration, MonteCarloRandom *  random);
+
+typedef struct
+{
+	MeanAndVariance	meanAndVariance;
+	uint64_t	wallTimeElapsedMicroSeconds;
+	uint64_t	cpuTimeElapsedMicroSeconds;
+	size_t		numberOfThreads;
+} MonteCarloRunResult;
+
+/**
+ *	@brief	Number of threads that `runMonteCarloIterations()` uses for `numberOfThreads`.
+ *
+ *	@param	numberOfThreads	Requested number of threads, 0 for one per online processor
+ *	@return			The number of threads, 1 where there are no threads
+ */
+size_t
+getMonteCarloThreadCount(size_t numberOfThreads);
+
+/**
+ *	@brief	Run `numberOfIterations` iterations of `kernel` on `numberOfThreads` threads
+ *		and collect their samples in a `MonteCarloSampleSink`.
+ *
+ *	@details Threads claim iterations in chunks, so that uneven iterations balance
+ *	out. The random number stream of each iteration only depends on `seed` and the
+ *	iteration, and the samples are collected in iteration order, so the results do
+ *	not depend on the number of threads. The cpu time in the samples file is that of
+ *	the whole process over the run.
+ *
+ *	@param	kernel			Computes the sample of an iteration
+ *	@param	threadContexts		`getMonteCarloThreadCount(numberOfThreads)` contexts, one
+ *					passed to each thread's kernel calls, or `NULL`
+ *	@param	numberOfThreads		Number of threads, 0 for one per online processor; typically
+ *					`numberOfThreads` from `parseArgs()`
+ *	@param	numberOfIterations	Number of iterations
+ *	@param	seed			Seed of the random number streams
+ *	@param	sampleType		Type of the collected samples
+ *	@param	isDumpEnabled		Whether to write the samples to the Monte Carlo samples file
+ *	@param	result			Mean, variance and wall and cpu times of the run
+ *	@return				`kCommonConstantReturnTypeError` on invalid arguments, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+runMonteCarloIterations(
+	MonteCarloKernel		kernel,
+	void * const *			threadContexts,
+	size_t				numberOfThreads,
+	size_t				numberOfIterations,
+	uint64_t			seed,
+	FloatingPointVariableType	sampleType,
+	bool				isDumpEnabled,
+	MonteCarloRunResult *		result);
+
+typedef enum
+{
+	kBenchmarkClockMonotonic	= 0,
+	kBenchmarkClockCycleCounter	= 1,
+} BenchmarkClock;
+
+/**
+ *	@brief	Code to benchmark, see `runBenchmark()`.
+ *
+ *	@param	context	The `context` passed to `runBenchmark()`
+ */
+typedef void (*BenchmarkFunction)(void *  context);
+
+typedef struct
+{
+	BenchmarkClock	clock;
+	size_t		numberOfWarmUpTrials;
+	size_t		minimumNumberOfTrials;
+	size_t		maximumNumberOfTrials;
+	double		targetRelativeConfidenceInterval;
+	uint64_t	maximumTotalMicroseconds;
+	bool		isPerformanceCountersEnabled;
+	uint64_t	bytesPerTrial;
+	uint64_t	itemsPerTrial;
+} BenchmarkOptions;
+
+typedef enum
+{
+	kPerformanceCounterCycles,
+	kPerformanceCounterInstructions,
+	kPerformanceCounterLLCMisses,
+	kPerformanceCounterBranchMisses,
+	kPerformanceCounterMax,
+} PerformanceCounter;
+
+typedef struct
+{
+	bool		isAvailable[kPerformanceCounterMax];
+	uint64_t	counts[kPerformanceCounterMax];
+} PerformanceCounterValues;
+
+typedef struct
+{
+	BenchmarkClock			clock;
+	size_t				numberOfTrials;
+	bool				isConverged;
+	double				meanMicroseconds;
+	double				standardDeviationMicroseconds;
+	double				confidenceIntervalMicroseconds;
+	double				minMicroseconds;
+	double				medianMicroseconds;
+	double				p95Microseconds;
+	double				p99Microseconds;
+	double				maxMicroseconds;
+	double				bytesPerSecond;
+	double				itemsPerSecond;
+	bool				isPeakResidentBytesAvailable;
+	uint64_t			peakResidentBytes;
+	PerformanceCounterValues	performanceCounters;
+} BenchmarkResult;
+
+/**
+ *	@brief	Set `options` to the defaults of `runBenchmark()`: monotonic clock, 3 warm-up
+ *		trials, 10 to 10000 trials until the 95% confidence interval of the mean is
+ *		within 1% of it, at most 10 s of trials, and no throughput.
+ *
+ *	@param	options	Options to set
+ */
+void
+getDefaultBenchmarkOptions(BenchmarkOptions *  options);
+
+/**
+ *	@brief	Time repeated calls of `function` until their mean time is known to the
+ *		precision asked for by `options`.
+ *
+ *	@details After `numberOfWarmUpTrials` untimed calls, times calls one at a time
+ *	until the half-width of the 95% confidence interval of the mean is at most
+ *	`targetRelativeConfidenceInterval` times the mean (after at least
+ *	`minimumNumberOfTrials`), or `maximumNumberOfTrials` trials or
+ *	`maximumTotalMicroseconds` (0 for no limit) of trials have run. With
+ *	`kBenchmarkClockCycleCounter`, trials are timed with the cycle counter (TSC on x86,
+ *	the virtual counter on AArch64), calibrated against the monotonic clock on first
+ *	use, falling back to the monotonic clock where there is none. The median time is
+ *	a good `cpuTimeElapsedMicroSeconds` for `saveMonteCarloFloatDataToDataDotOutFile()`
+ *	in benchmarking mode.
+ *
+ *	With `isPerformanceCountersEnabled`, the timed trials of the calling thread are
+ *	also counted in user space with the hardware cycle, instruction, last-level cache
+ *	miss and branch miss counters through perf_event_open on Linux. A counter that is
+ *	not available, for example in a container, is marked so in `performanceCounters`
+ *	and the benchmark runs regardless.
+ *
+ *	With a non-zero `bytesPerTrial` or `itemsPerTrial` (rows, values or samples, as
+ *	suits `function`), the throughput at the median trial time is reported in
+ *	`bytesPerSecond` or `itemsPerSecond`. `peakResidentBytes` is the peak resident
+ *	set size of the process after the trials, where `getrusage()` reports it.
+ *
+ *	@param	function	Code to time
+ *	@param	context		Passed to `function`
+ *	@param	options		Options, see `getDefaultBenchmarkOptions()`
+ *	@param	result		Statistics of the trial times
+ *	@return			`kCommonConstantReturnTypeError` on invalid arguments, `kCommonConstantReturnTypeSuccess` on success
+ */
+CommonConstantReturnType
+runBenchmark(
+	BenchmarkFunction		function,
+	void *				context,
+	const BenchmarkOptions *	options,
+	BenchmarkResult *		result);
+
+/**
+ *	@brief	Print `result` to the standard output as a one-line JSON object.
+ *
+ *	@details Throughputs and the peak resident set size are `null` where they are not
+ *	known, so that runs can be compared field by field.
+ *
+ *	@param	name	Name of the benchmark
+ *	@param	result	Result of `runBenchmark()`
+ */
+void
+printBenchmarkResult(
+	const char *		name,
+	const BenchmarkResult *	result);
+
 /**
  *	@brief	Call Malloc and abort on allocation failure.
  *
@@ -384,6 +1674,24 @@ checkedCalloc(
 	const char *	file,
 	int		line);
 
+/**
+ *	@brief	Call posix_memalign and abort on allocation failure.
+ *
+ *	@details The memory is released with `free()`.
+ *
+ *	@param	alignment	Passed to posix_memalign, a power of two and a multiple of `sizeof(void *)`
+ *	@param	size		Number of bytes to allocate
+ *	@param	file		File name to include in error message
+ *	@param	line		Line number to include in error message
+ *	@return			Pointer as returned by posix_memalign
+ */
+void *
+checkedAlignedMalloc(
+	size_t		alignment,
+	size_t		size,
+	const char *	file,
+	int		line);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif